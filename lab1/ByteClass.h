@@ -0,0 +1,181 @@
+#ifndef BYTE_CLASS_H
+#define BYTE_CLASS_H
+
+#include <cstddef>
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BYTE_CLASS_X86_AVX2
+#include <immintrin.h>
+#endif
+
+/*
+ * 词法分析热循环用的字节分类表
+ * 代替 isalpha/isspace/isdigit：不受 locale 影响，对 >= 0x80 的字节也有定义（不属于任何一类，
+ * 与 "C" locale 下的结果一致），并且只是一次查表
+*/
+enum ByteClassBit
+{
+    BYTE_SPACE = 1,  // ' ' \t \n \v \f \r
+    BYTE_DIGIT = 2,  // 0-9
+    BYTE_ALPHA = 4,  // A-Z a-z
+    BYTE_IDENT = 8,  // 字母、数字、下划线
+};
+
+struct byte_class_table_t
+{
+    unsigned char bits[256];
+};
+
+constexpr byte_class_table_t make_byte_class_table()
+{
+    byte_class_table_t table = {};
+    for (int c = 0; c < 256; c++)
+    {
+        unsigned char bits = 0;
+        if (c == ' ' || (c >= '\t' && c <= '\r'))
+            bits |= BYTE_SPACE;
+        if (c >= '0' && c <= '9')
+            bits |= BYTE_DIGIT | BYTE_IDENT;
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
+            bits |= BYTE_ALPHA | BYTE_IDENT;
+        if (c == '_')
+            bits |= BYTE_IDENT;
+        table.bits[c] = bits;
+    }
+    return table;
+}
+
+constexpr byte_class_table_t BYTE_CLASS = make_byte_class_table();
+
+inline bool byte_is(char c, unsigned char bits)
+{
+    return (BYTE_CLASS.bits[static_cast<unsigned char>(c)] & bits) != 0;
+}
+
+inline bool is_space_byte(char c) { return byte_is(c, BYTE_SPACE); }
+inline bool is_digit_byte(char c) { return byte_is(c, BYTE_DIGIT); }
+inline bool is_alpha_byte(char c) { return byte_is(c, BYTE_ALPHA); }
+
+#ifdef BYTE_CLASS_X86_AVX2
+/* 运行时检查一次 CPU 是否支持 AVX2；默认构建只假定 SSE2，AVX2 版本靠 target 属性单独编译 */
+inline bool byte_class_has_avx2()
+{
+    static const bool supported = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+}
+
+/* 每次检查 32 个字节，在最后一个不完整的块之前停下，剩下的交给调用者 */
+__attribute__((target("avx2"))) inline size_t ascii_prefix_length_avx2(const char *p, size_t n)
+{
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i))));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    return i;
+}
+#endif
+
+/* [p, p + n) 开头连续的 ASCII 字节数，每次检查 32（CPU 支持 AVX2 时）或 16（SSE2）个字节 */
+inline size_t ascii_prefix_length(const char *p, size_t n)
+{
+    size_t i = 0;
+#ifdef BYTE_CLASS_X86_AVX2
+    if (n >= 32 && byte_class_has_avx2())
+    {
+        i = ascii_prefix_length_avx2(p, n);
+        if (i + 32 <= n)
+            return i; // 停在完整的块内：p[i] 不是 ASCII
+    }
+#endif
+#ifdef __SSE2__
+    for (; i + 16 <= n; i += 16)
+    {
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i))));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    while (i < n && static_cast<unsigned char>(p[i]) < 0x80)
+        i++;
+    return i;
+}
+
+/* [p, p + n) 中第一个等于 a 或 b 的字节的位置，没有时返回 n */
+inline size_t find_either_byte(const char *p, size_t n, char a, char b)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        unsigned mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, va), _mm_cmpeq_epi8(bytes, vb))));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    while (i < n && p[i] != a && p[i] != b)
+        i++;
+    return i;
+}
+
+/*
+ * [p, p + n) 是否为合法的 UTF-8
+ * 纯 ASCII 的部分用 ascii_prefix_length 整块跳过，只有遇到多字节序列时才逐字节检查
+ * （拒绝过长编码、代理区 U+D800..U+DFFF 与超过 U+10FFFF 的码点）
+*/
+inline bool utf8_valid(const char *p, size_t n)
+{
+    const unsigned char *s = reinterpret_cast<const unsigned char *>(p);
+    size_t i = 0;
+    while (true)
+    {
+        i += ascii_prefix_length(p + i, n - i);
+        if (i >= n)
+            return true;
+        unsigned char lead = s[i];
+        size_t length;
+        unsigned char lo = 0x80, hi = 0xBF; // 第二个字节的取值范围
+        if (lead >= 0xC2 && lead <= 0xDF)
+            length = 2;
+        else if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            length = 3;
+            if (lead == 0xE0)
+                lo = 0xA0;
+            else if (lead == 0xED)
+                hi = 0x9F;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            length = 4;
+            if (lead == 0xF0)
+                lo = 0x90;
+            else if (lead == 0xF4)
+                hi = 0x8F;
+        }
+        else
+            return false;
+        if (n - i < length || s[i + 1] < lo || s[i + 1] > hi)
+            return false;
+        for (size_t k = 2; k < length; k++)
+        {
+            if (s[i + k] < 0x80 || s[i + k] > 0xBF)
+                return false;
+        }
+        i += length;
+    }
+}
+
+#endif
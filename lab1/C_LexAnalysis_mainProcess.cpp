@@ -1,7 +1,25 @@
-#include "acx.cpp"
-int main()
+#include "LexAnalysis.h"
+int main(int argc, char *argv[])
 {
-	Analysis(); 
-	return 0;
+	for (int i = 1; i < argc; i++)
+	{
+		// -j N / --threads N：用 N 个线程并行分析
+		if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--threads") == 0) && i + 1 < argc)
+			lex_options.threads = static_cast<size_t>(atoi(argv[++i]));
+		// --keys FILE：使用自定义词表代替内置的 c_keys.txt
+		else if (strcmp(argv[i], "--keys") == 0 && i + 1 < argc)
+			lex_options.keys_path = argv[++i];
+		// --stats：分析结束后把热路径统计以 JSON 格式写到 stderr
+		else if (strcmp(argv[i], "--stats") == 0)
+			lex_options.stats = true;
+		// --directives：把 # 开头的预处理指令行识别为一个单元
+		else if (strcmp(argv[i], "--directives") == 0)
+			lex_options.directives = true;
+		// --follow-includes：在指令之后展开 #include "..." 的内容，-I DIR 追加查找目录
+		else if (strcmp(argv[i], "--follow-includes") == 0)
+			lex_options.follow_includes = true;
+		else if (strcmp(argv[i], "-I") == 0 && i + 1 < argc)
+			lex_options.include_dirs.push_back(argv[++i]);
+	}
+	return Analysis();
 }
-
@@ -0,0 +1,264 @@
+#ifndef CORPUS_GENERATOR_H
+#define CORPUS_GENERATOR_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/*
+ * 合成 C 语言语料生成器，供基准测试使用
+ * 使用自带的 xorshift 随机数，同一组 (mix, size, seed) 在任何平台上都生成完全相同的文本
+ * 生成的内容只包含词法分析器能够识别的单元，单元之间总以空白分隔
+*/
+enum CorpusMix
+{
+    MIX_BALANCED,   // 接近普通 C 代码的比例
+    MIX_NUMERIC,    // 以各种进制、后缀的常数为主
+    MIX_COMMENT,    // 以单行、多行注释为主
+    MIX_STRING,     // 以带转义的字符串为主
+    MIX_OPERATOR,   // 运算符密集
+    MIX_DATA,       // 数据表：以很长的常数为主（大整数、长十六进制串、长小数），数字串足够长，DFA 的自环加速能起作用
+    MIX_COUNT
+};
+
+class CorpusGenerator
+{
+    enum Piece
+    {
+        PIECE_KEYWORD,
+        PIECE_IDENTIFIER,
+        PIECE_NUMBER,
+        PIECE_COMMENT,
+        PIECE_STRING,
+        PIECE_OPERATOR,
+        PIECE_COUNT
+    };
+
+    uint64_t state;
+    unsigned weights[PIECE_COUNT];
+    bool long_numbers;
+
+    uint64_t next()
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 2685821657736338717ULL;
+    }
+
+    size_t below(size_t n)
+    {
+        return static_cast<size_t>(next() % n);
+    }
+
+    template <size_t N>
+    const char *pick(const char *const (&table)[N])
+    {
+        return table[below(N)];
+    }
+
+    void append_word(std::string &out, size_t min_len, size_t max_len)
+    {
+        static const char first[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+        static const char rest[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+        size_t len = min_len + below(max_len - min_len + 1);
+        out.push_back(first[below(sizeof(first) - 1)]);
+        for (size_t i = 1; i < len; i++)
+            out.push_back(rest[below(sizeof(rest) - 1)]);
+    }
+
+    void append_digits(std::string &out, const char *digits, size_t min_len, size_t max_len)
+    {
+        size_t count = strlen(digits);
+        size_t len = min_len + below(max_len - min_len + 1);
+        for (size_t i = 0; i < len; i++)
+            out.push_back(digits[below(count)]);
+    }
+
+    void append_long_number(std::string &out)
+    {
+        switch (below(3))
+        {
+        case 0: // 大整数
+            out.push_back("123456789"[below(9)]);
+            append_digits(out, "0123456789", 15, 39);
+            break;
+        case 1: // 长十六进制串
+            out += "0x";
+            append_digits(out, "0123456789abcdef", 16, 32);
+            break;
+        default: // 长小数
+            append_digits(out, "0123456789", 1, 3);
+            out.push_back('.');
+            append_digits(out, "0123456789", 12, 24);
+            break;
+        }
+    }
+
+    void append_number(std::string &out)
+    {
+        if (long_numbers)
+        {
+            append_long_number(out);
+            return;
+        }
+        static const char *const int_suffix[] = {"", "", "", "u", "L", "UL", "ll", "LLU"};
+        static const char *const frac_suffix[] = {"", "", "f", "L"};
+        switch (below(6))
+        {
+        case 0: // 十进制整数
+            out.push_back("123456789"[below(9)]);
+            append_digits(out, "0123456789", 0, 9);
+            out += pick(int_suffix);
+            break;
+        case 1: // 十六进制整数
+            out += below(2) ? "0x" : "0X";
+            append_digits(out, "0123456789abcdefABCDEF", 1, 8);
+            out += pick(int_suffix);
+            break;
+        case 2: // 八进制 / 二进制整数
+            if (below(2))
+            {
+                out.push_back('0');
+                append_digits(out, "01234567", 1, 6);
+            }
+            else
+            {
+                out += "0b";
+                append_digits(out, "01", 1, 16);
+            }
+            out += pick(int_suffix);
+            break;
+        case 3: // 带小数点的小数
+            append_digits(out, "0123456789", 1, 6);
+            out.push_back('.');
+            append_digits(out, "0123456789", 1, 6);
+            out += pick(frac_suffix);
+            break;
+        case 4: // 省略整数部分的小数
+            out.push_back('.');
+            append_digits(out, "0123456789", 1, 6);
+            out += pick(frac_suffix);
+            break;
+        default: // 指数形式
+            append_digits(out, "0123456789", 1, 4);
+            out.push_back(below(2) ? 'e' : 'E');
+            out += below(3) == 0 ? "-" : (below(2) ? "+" : "");
+            append_digits(out, "0123456789", 1, 3);
+            out += pick(frac_suffix);
+            break;
+        }
+    }
+
+    void append_comment(std::string &out)
+    {
+        bool block = below(2) != 0;
+        out += block ? "/*" : "//";
+        size_t words = 1 + below(12);
+        for (size_t i = 0; i < words; i++)
+        {
+            out.push_back(' ');
+            append_word(out, 1, 10);
+            if (block && below(6) == 0)
+                out.push_back('\n');
+        }
+        out += block ? " */" : "\n";
+    }
+
+    void append_string(std::string &out)
+    {
+        static const char *const escapes[] = {"\\n", "\\t", "\\\\", "\\\"", "\\0", "%d", ", "};
+        out.push_back('"');
+        size_t parts = 1 + below(8);
+        for (size_t i = 0; i < parts; i++)
+        {
+            if (below(3) == 0)
+                out += pick(escapes);
+            else
+                append_word(out, 1, 8);
+            if (below(2))
+                out.push_back(' ');
+        }
+        out.push_back('"');
+    }
+public:
+    CorpusGenerator(CorpusMix mix, uint64_t seed = 1)
+        : state(seed * 0x9E3779B97F4A7C15ULL + 1), long_numbers(mix == MIX_DATA)
+    {
+        //                                        关键字 标识符 常数 注释 字符串 运算符
+        static const unsigned table[MIX_COUNT][PIECE_COUNT] = {
+            {15, 30, 10, 5, 4, 36},   // MIX_BALANCED
+            {5, 10, 60, 2, 1, 22},    // MIX_NUMERIC
+            {8, 12, 4, 60, 2, 14},    // MIX_COMMENT
+            {8, 12, 4, 2, 56, 18},    // MIX_STRING
+            {4, 18, 6, 1, 1, 70},     // MIX_OPERATOR
+            {1, 4, 60, 1, 0, 34},     // MIX_DATA
+        };
+        memcpy(weights, table[mix], sizeof(weights));
+    }
+
+    static const char *mix_name(CorpusMix mix)
+    {
+        static const char *const names[MIX_COUNT] = {"balanced", "numeric", "comment", "string", "operator", "data"};
+        return names[mix];
+    }
+
+    /* 生成约 size 字节的语料（以完整的单元结尾，可能略多于 size） */
+    std::string generate(size_t size)
+    {
+        static const char *const keywords[] = {
+            "int", "char", "double", "if", "else", "while", "for", "return", "struct", "static",
+            "const", "unsigned", "void", "sizeof", "switch", "case", "break", "long", "float"};
+        static const char *const operators[] = {
+            "=", "==", "+", "++", "+=", "-", "--", "->", "*", "/", "%", "<", "<=", "<<", "<<=",
+            ">", ">=", ">>", ">>=", "!", "!=", "&", "&&", "|", "||", "^", "~", "?", ":",
+            ";", ";", ";", ",", ",", "(", ")", "(", ")", "[", "]", "{", "}", "."};
+        unsigned total = 0;
+        for (unsigned w : weights)
+            total += w;
+
+        std::string out;
+        out.reserve(size + 256);
+        size_t line_start = 0;
+        while (out.size() < size)
+        {
+            size_t roll = below(total);
+            int piece = 0;
+            while (roll >= weights[piece])
+                roll -= weights[piece++];
+            switch (piece)
+            {
+            case PIECE_KEYWORD:
+                out += pick(keywords);
+                break;
+            case PIECE_IDENTIFIER:
+                append_word(out, 1, 12);
+                break;
+            case PIECE_NUMBER:
+                append_number(out);
+                break;
+            case PIECE_COMMENT:
+                append_comment(out);
+                break;
+            case PIECE_STRING:
+                append_string(out);
+                break;
+            default:
+                out += pick(operators);
+                break;
+            }
+            if (out.back() == '\n')
+                line_start = out.size();
+            else if (out.size() - line_start > 72)
+            {
+                out.push_back('\n');
+                line_start = out.size();
+            }
+            else
+                out.push_back(below(8) == 0 ? '\t' : ' ');
+        }
+        return out;
+    }
+};
+
+#endif
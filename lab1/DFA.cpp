@@ -1,5 +1,9 @@
 #include "DFA.h"
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <numeric>
+#include <thread>
 
 void trim_inplace(std::string& str) {
     size_t start = str.find_first_not_of(" \t\n\r");
@@ -276,7 +280,11 @@ NFA::NFA(const NFA& other)
 }
 NFA::NFA(const RE& re)
 {
-    RE postfix_re = re.postfix_form();
+    *this = from_postfix(re.postfix_form());
+}
+NFA NFA::from_postfix(const RE& postfix_form)
+{
+    RE postfix_re = postfix_form;
     auto re_pattern = postfix_re.getPattern();
     auto pattern = re_pattern.first;
     auto op_pattern = re_pattern.second;
@@ -324,7 +332,7 @@ NFA::NFA(const RE& re)
             }
         }
     }
-    *this = *(nfa_stack.top());
+    return *(nfa_stack.top());
 }
 NFA::NFA(const char terminal)
 {
@@ -402,6 +410,152 @@ bool NFA::plus()
     this -> final_state = new_final_state;
     return true;
 }
+void NFA::simplify()
+{
+    // Number the states reachable from the start state; owned_states may still hold unreachable pieces.
+    std::unordered_map<const nfa_state*, int> index;
+    std::vector<const nfa_state*> states;
+    auto number = [&](const nfa_state *st) {
+        auto found = index.find(st);
+        if (found != index.end())
+            return found -> second;
+        index.emplace(st, (int)states.size());
+        states.push_back(st);
+        return (int)states.size() - 1;
+    };
+    number(start_state.get());
+    std::vector<std::vector<int>> epsilon_edges;
+    std::vector<std::vector<std::pair<char, int>>> symbol_edges;
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        epsilon_edges.emplace_back();
+        symbol_edges.emplace_back();
+        for (const auto& tr: states[i] -> transfers)
+        {
+            auto target = tr.second.lock();
+            if (!target)
+                continue;
+            int t = number(target.get());
+            if (tr.first == '\0')
+                epsilon_edges[i].push_back(t);
+            else
+                symbol_edges[i].push_back({tr.first, t});
+        }
+    }
+    size_t n = states.size();
+
+    // Collapse epsilon chains: a non-final state whose only edge is an epsilon edge is passed
+    // straight through to the end of its chain. The union finals of a long alternation form such a
+    // chain, and without this every alternative's closure would walk it again.
+    std::vector<int> chain_end(n, -1), path;
+    auto skip_chain = [&](int s) {
+        path.clear();
+        while (chain_end[s] < 0)
+        {
+            chain_end[s] = s; // provisional, stops a cycle
+            if (states[s] -> is_final || !symbol_edges[s].empty() || epsilon_edges[s].size() != 1)
+                break;
+            path.push_back(s);
+            s = epsilon_edges[s][0];
+        }
+        for (int p: path)
+            chain_end[p] = chain_end[s];
+        return chain_end[s];
+    };
+
+    // Step 1: epsilon elimination. Only the start state and targets of symbol edges survive; each of
+    // them takes over the symbol edges and the finality of everything in its epsilon closure.
+    std::vector<bool> is_final(n, false), kept(n, false);
+    std::vector<std::vector<std::pair<char, int>>> edges(n);
+    std::vector<int> kept_order = {0}, visited(n, -1), stack;
+    kept[0] = true;
+    for (size_t k = 0; k < kept_order.size(); k++)
+    {
+        int s = kept_order[k];
+        visited[s] = s;
+        stack.assign(1, s);
+        while (!stack.empty())
+        {
+            int cur = stack.back();
+            stack.pop_back();
+            if (states[cur] -> is_final)
+                is_final[s] = true;
+            for (const auto& edge: symbol_edges[cur])
+            {
+                edges[s].push_back(edge);
+                if (!kept[edge.second])
+                {
+                    kept[edge.second] = true;
+                    kept_order.push_back(edge.second);
+                }
+            }
+            for (int t: epsilon_edges[cur])
+            {
+                t = skip_chain(t);
+                if (visited[t] != s)
+                {
+                    visited[t] = s;
+                    stack.push_back(t);
+                }
+            }
+        }
+        std::sort(edges[s].begin(), edges[s].end());
+        edges[s].erase(std::unique(edges[s].begin(), edges[s].end()), edges[s].end());
+    }
+
+    // Step 2: merge states whose finality and out-edges are identical, repeating while merged targets
+    // make further out-edge sets identical (partition refinement starting from final / non-final).
+    std::vector<int> block(n, 0);
+    for (int s: kept_order)
+        block[s] = is_final[s];
+    size_t block_count = 0;
+    while (true)
+    {
+        std::map<std::pair<int, std::vector<std::pair<char, int>>>, int> signatures;
+        std::vector<int> next(n, 0);
+        for (int s: kept_order)
+        {
+            std::vector<std::pair<char, int>> signature;
+            signature.reserve(edges[s].size());
+            for (const auto& edge: edges[s])
+                signature.push_back({edge.first, block[edge.second]});
+            std::sort(signature.begin(), signature.end());
+            signature.erase(std::unique(signature.begin(), signature.end()), signature.end());
+            next[s] = signatures.emplace(std::make_pair(block[s], std::move(signature)), (int)signatures.size())
+                          .first -> second;
+        }
+        block.swap(next);
+        if (signatures.size() == block_count)
+            break;
+        block_count = signatures.size();
+    }
+
+    // Step 3: rebuild with one fresh state per block. The old states may be shared with copies of this
+    // NFA, so they are left untouched.
+    std::vector<std::shared_ptr<nfa_state>> merged(block_count);
+    for (auto& st: merged)
+        st = std::make_shared<nfa_state>();
+    std::vector<bool> built(block_count, false);
+    terminal_chars.clear();
+    for (int s: kept_order)
+    {
+        auto& st = merged[block[s]];
+        if (built[block[s]])
+            continue;
+        built[block[s]] = true;
+        st -> is_final = is_final[s];
+        std::set<std::pair<char, int>> targets;
+        for (const auto& edge: edges[s])
+            if (targets.insert({edge.first, block[edge.second]}).second)
+            {
+                st -> transfers.insert({edge.first, merged[block[edge.second]]});
+                terminal_chars.insert(edge.first);
+            }
+    }
+    start_state = merged[block[0]];
+    final_state = nullptr;
+    owned_states = std::move(merged);
+}
 NFA::~NFA()
 {
 }
@@ -448,8 +602,22 @@ nfa_state_set_t DFA::epsilon_closure(const nfa_state_set_t& states)
     }
     return result;
 }
-DFA::DFA(const NFA& nfa)
+DFA::DFA(const NFA& input, dfa_build_stats_t *stats)
 {
+    auto phase_start = std::chrono::steady_clock::now();
+    auto end_phase = [&](double dfa_build_stats_t::*seconds) {
+        auto now = std::chrono::steady_clock::now();
+        if (stats)
+            stats->*seconds = std::chrono::duration<double>(now - phase_start).count();
+        phase_start = now;
+    };
+    if (stats)
+        stats->nfa_states = input.state_count();
+    // Determinise an epsilon-free, merged copy: fewer and smaller state sets, and the '\0' used for
+    // epsilon never becomes a DFA symbol. simplify() builds new states, so input is not modified.
+    NFA nfa = input;
+    nfa.simplify();
+    end_phase(&dfa_build_stats_t::simplify_seconds);
     this -> terminal_chars.insert(nfa.terminal_chars.begin(), nfa.terminal_chars.end());
     nfa_state_set_t closure_states;
     std::map<nfa_state_set_t, std::shared_ptr<dfa_state>> old2new_map;
@@ -492,15 +660,27 @@ DFA::DFA(const NFA& nfa)
             }
         }
     }
+    end_phase(&dfa_build_stats_t::subset_seconds);
+    if (stats)
+    {
+        stats->simplified_states = nfa.state_count();
+        stats->subset_states = owned_states.size();
+    }
 
     this -> minimize();
+    end_phase(&dfa_build_stats_t::minimize_seconds);
+    compile();
+    relayout(bfs_order());
+    end_phase(&dfa_build_stats_t::compile_seconds);
+    if (stats)
+        stats->dfa_states = owned_states.size();
 }
 void DFA::minimize()
 {
     if (!start_state || owned_states.empty())
         return;
 
-    // Step 1: remove unreachable states so we do not keep dead nodes around.
+    // Step 1: remove states the start state cannot reach.
     std::queue<std::shared_ptr<dfa_state>> q;
     std::unordered_set<std::shared_ptr<dfa_state>> reachable;
     q.push(start_state);
@@ -520,13 +700,51 @@ void DFA::minimize()
         }
     }
 
+    // Step 2: remove dead states, from which no final state can be reached, by a reverse search
+    // from the finals. Transitions into them are dropped, so a match stops at the byte that would
+    // enter one instead of walking on through input it can never accept; the missing transition
+    // is the single dead state of the compiled table. The start state stays even if it is dead.
+    std::unordered_map<std::shared_ptr<dfa_state>, std::vector<std::shared_ptr<dfa_state>>> predecessors;
+    std::unordered_set<std::shared_ptr<dfa_state>> live;
+    for (const auto &st : reachable)
+    {
+        for (const auto &tr : st->transfers)
+        {
+            auto target = tr.second.lock();
+            if (target)
+                predecessors[target].push_back(st);
+        }
+        if (st->is_final && live.insert(st).second)
+            q.push(st);
+    }
+    while (!q.empty())
+    {
+        auto cur = q.front();
+        q.pop();
+        for (const auto &pred : predecessors[cur])
+        {
+            if (live.insert(pred).second)
+                q.push(pred);
+        }
+    }
+
     std::vector<std::shared_ptr<dfa_state>> states;
-    states.reserve(reachable.size());
+    states.reserve(live.size() + 1);
     for (const auto &st : owned_states)
     {
-        if (reachable.count(st))
+        if (reachable.count(st) && (live.count(st) || st == start_state))
             states.push_back(st);
     }
+    for (const auto &st : states)
+    {
+        for (auto tr = st->transfers.begin(); tr != st->transfers.end();)
+        {
+            if (live.count(tr->second.lock()))
+                ++tr;
+            else
+                tr = st->transfers.erase(tr);
+        }
+    }
 
     if (states.size() <= 1)
     {
@@ -539,102 +757,61 @@ void DFA::minimize()
     for (size_t i = 0; i < states.size(); i++)
         id_map[states[i]] = static_cast<int>(i);
 
-    // Precompute transitions as indices; missing transitions stay at -1 (implicit sink).
-    std::vector<std::unordered_map<char, int>> trans(states.size());
-    for (size_t i = 0; i < states.size(); i++)
+    // Precompute transitions as a flat table over the terminal chars; missing transitions stay
+    // at -1 (implicit sink).
+    const size_t n = states.size();
+    std::vector<char> chars(terminal_chars.begin(), terminal_chars.end());
+    std::sort(chars.begin(), chars.end());
+    const size_t m = chars.size();
+    std::vector<int> trans(n * m, -1);
+    for (size_t i = 0; i < n; i++)
     {
-        for (const auto &tr : states[i]->transfers)
+        for (size_t k = 0; k < m; k++)
         {
-            auto target = tr.second.lock();
+            auto tr = states[i]->transfers.find(chars[k]);
+            if (tr == states[i]->transfers.end())
+                continue;
+            auto target = tr->second.lock();
             auto itr = id_map.find(target);
             if (target && itr != id_map.end())
-                trans[i][tr.first] = itr->second;
+                trans[i * m + k] = itr->second;
         }
     }
 
-    const size_t n = states.size();
-    std::vector<std::vector<bool>> distinguish(n, std::vector<bool>(n, false));
-
-    // Initialize distinguishing table: final vs non-final.
+    // Moore refinement: start from final vs non-final and split blocks by the blocks their
+    // transitions lead to (a missing transition only matches a missing one) until nothing
+    // splits. Two states end up in the same block iff no string tells them apart. Block ids
+    // are numbered by first occurrence, so the block of state i never exceeds i.
+    std::vector<int> block(n);
     for (size_t i = 0; i < n; i++)
+        block[i] = states[i]->is_final ? 1 : 0;
+    size_t block_count = 0;
+    while (true)
     {
-        for (size_t j = i + 1; j < n; j++)
-        {
-            if (states[i]->is_final != states[j]->is_final)
-            {
-                distinguish[i][j] = true;
-                distinguish[j][i] = true;
-            }
-        }
-    }
-
-    bool updated = true;
-    while (updated)
-    {
-        updated = false;
+        std::map<std::vector<int>, int> signatures;
+        std::vector<int> next(n);
+        std::vector<int> signature(m + 1);
         for (size_t i = 0; i < n; i++)
         {
-            for (size_t j = i + 1; j < n; j++)
+            signature[0] = block[i];
+            for (size_t k = 0; k < m; k++)
             {
-                if (distinguish[i][j])
-                    continue;
-
-                for (const auto &ch : terminal_chars)
-                {
-                    auto it_i = trans[i].find(ch);
-                    auto it_j = trans[j].find(ch);
-                    int ti = (it_i == trans[i].end()) ? -1 : it_i->second;
-                    int tj = (it_j == trans[j].end()) ? -1 : it_j->second;
-
-                    if (ti == -1 && tj == -1)
-                        continue;
-
-                    if (ti == -1 || tj == -1)
-                    {
-                        distinguish[i][j] = distinguish[j][i] = true;
-                        updated = true;
-                        break;
-                    }
-
-                    size_t a = std::min(ti, tj);
-                    size_t b = std::max(ti, tj);
-                    if (distinguish[a][b])
-                    {
-                        distinguish[i][j] = distinguish[j][i] = true;
-                        updated = true;
-                        break;
-                    }
-                }
+                int target = trans[i * m + k];
+                signature[k + 1] = target < 0 ? -1 : block[target];
             }
+            next[i] = signatures.emplace(signature, static_cast<int>(signatures.size())).first->second;
         }
+        block.swap(next);
+        if (signatures.size() == block_count)
+            break;
+        block_count = signatures.size();
     }
 
-    // Union-find to merge indistinguishable states.
-    std::vector<int> parent(n);
-    std::iota(parent.begin(), parent.end(), 0);
-
-    std::function<int(int)> find = [&](int x) -> int
+    auto find = [&](int x) -> int
     {
-        return parent[x] == x ? x : parent[x] = find(parent[x]);
+        return block[x];
     };
 
-    auto unite = [&](int a, int b)
-    {
-        a = find(a);
-        b = find(b);
-        if (a != b)
-            parent[b] = a;
-    };
-
-    for (size_t i = 0; i < n; i++)
-    {
-        for (size_t j = i + 1; j < n; j++)
-        {
-            if (!distinguish[i][j])
-                unite(static_cast<int>(i), static_cast<int>(j));
-        }
-    }
-
     // Build new minimized DFA states.
     std::unordered_map<int, int> rep2idx;
     std::vector<std::shared_ptr<dfa_state>> new_states;
@@ -659,10 +836,12 @@ void DFA::minimize()
     {
         int rep_src = find(static_cast<int>(i));
         auto src_state = new_states[rep2idx[rep_src]];
-        for (const auto &tr : trans[i])
+        for (size_t k = 0; k < m; k++)
         {
-            int rep_dst = find(tr.second);
-            src_state->transfers[tr.first] = new_states[rep2idx[rep_dst]];
+            if (trans[i * m + k] < 0)
+                continue;
+            int rep_dst = find(trans[i * m + k]);
+            src_state->transfers[chars[k]] = new_states[rep2idx[rep_dst]];
         }
     }
 
@@ -711,60 +890,821 @@ DFA::DFA(const std::string &import_str)
     }
     this -> start_state = owned_states[0];
     this -> minimize();
+    compile();
+    relayout(bfs_order());
 }
-size_t DFA::longest_match(const std::string& input, size_t start_pos)
+DFA DFA::product(const DFA &a, const DFA &b, product_op_t op)
 {
-    auto current_states = start_state;
-    size_t matched_length = 0;
-    for (size_t i = start_pos; i < input.length(); i++)
+    // Pairs (state of a, state of b) reached from the start pair, breadth first; -1 stands for
+    // "this side has no transition", and a pair whose outcome is already settled as rejecting
+    // is left out, so missing transitions stay missing.
+    auto keep = [op](int p, int q) {
+        switch (op)
+        {
+        case PRODUCT_UNION:
+            return p >= 0 || q >= 0;
+        case PRODUCT_INTERSECTION:
+            return p >= 0 && q >= 0;
+        case PRODUCT_DIFFERENCE:
+            return p >= 0;
+        }
+        return false;
+    };
+    auto accepts = [op](bool p, bool q) {
+        switch (op)
+        {
+        case PRODUCT_UNION:
+            return p || q;
+        case PRODUCT_INTERSECTION:
+            return p && q;
+        case PRODUCT_DIFFERENCE:
+            return p && !q;
+        }
+        return false;
+    };
+    auto step = [](const DFA &dfa, int state, int c) {
+        return state < 0 ? -1 : dfa.table[state * dfa.class_count + dfa.byte_class[c]];
+    };
+
+    DFA res;
+    std::map<std::pair<int, int>, int> pair_ids;
+    std::vector<std::pair<int, int>> pairs;
+    auto pair_id = [&](int p, int q) {
+        auto found = pair_ids.find(std::make_pair(p, q));
+        if (found != pair_ids.end())
+            return found->second;
+        int id = static_cast<int>(pairs.size());
+        pair_ids.emplace(std::make_pair(p, q), id);
+        pairs.emplace_back(p, q);
+        auto state = std::make_shared<dfa_state>();
+        state->is_final = accepts(p >= 0 && a.finals[p], q >= 0 && b.finals[q]);
+        res.owned_states.push_back(state);
+        return id;
+    };
+    pair_id(a.finals.empty() ? -1 : 0, b.finals.empty() ? -1 : 0);
+    for (size_t head = 0; head < pairs.size(); head++)
     {
-        bool transitioned = false;
-        auto valid_transfers = current_states -> transfers.equal_range(input[i]);
-        if (valid_transfers.first == valid_transfers.second)
-            break;
-        for (auto transfer = valid_transfers.first; transfer != valid_transfers.second; transfer++)
+        const int p = pairs[head].first, q = pairs[head].second;
+        for (int c = 0; c < 256; c++)
         {
-            auto target = transfer -> second.lock();
-            if (target)
-            {
-                current_states = target;
-                transitioned = true;
-                matched_length++;
-                break;
-            }
+            int tp = step(a, p, c), tq = step(b, q, c);
+            if (!keep(tp, tq))
+                continue;
+            int target = pair_id(tp, tq);
+            res.owned_states[head]->transfers[char(c)] = res.owned_states[target];
+            res.terminal_chars.insert(char(c));
         }
+    }
+    res.start_state = res.owned_states[0];
+    res.minimize();
+    res.compile();
+    res.relayout(res.bfs_order());
+    return res;
+}
+DFA DFA::unite(const DFA &other) const
+{
+    return product(*this, other, PRODUCT_UNION);
+}
+DFA DFA::intersect(const DFA &other) const
+{
+    return product(*this, other, PRODUCT_INTERSECTION);
+}
+DFA DFA::subtract(const DFA &other) const
+{
+    return product(*this, other, PRODUCT_DIFFERENCE);
+}
+DFA DFA::complement() const
+{
+    // Every string minus this language; the universal DFA is one final state looping on every byte.
+    DFA all;
+    auto state = std::make_shared<dfa_state>();
+    state->is_final = true;
+    for (int c = 0; c < 256; c++)
+    {
+        state->transfers[char(c)] = state;
+        all.terminal_chars.insert(char(c));
+    }
+    all.owned_states.push_back(state);
+    all.start_state = state;
+    all.compile();
+    return product(all, *this, PRODUCT_DIFFERENCE);
+}
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DFA_X86_SIMD
+#include <immintrin.h>
 
-        if (!transitioned)
+// 0: scalar, 1: SSSE3, 2: AVX2; the default build only assumes SSE2, so pick at run time.
+static int dfa_simd_level()
+{
+    static const int level = []()
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return 2;
+        if (__builtin_cpu_supports("ssse3"))
+            return 1;
+        return 0;
+    }();
+    return level;
+}
+
+// Number of leading bytes in the set, looking at 16 bytes per step; stops before the last
+// partial block, the caller finishes it with the scalar check.
+__attribute__((target("ssse3")))
+static size_t self_loop_run_ssse3(const unsigned char *lo, const unsigned char *hi, const char *data, size_t length)
+{
+    const __m128i lo_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lo));
+    const __m128i hi_table = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hi));
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        __m128i lo_bits = _mm_shuffle_epi8(lo_table, _mm_and_si128(bytes, nibble));
+        __m128i hi_bits = _mm_shuffle_epi8(hi_table, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+        __m128i outside = _mm_cmpeq_epi8(_mm_and_si128(lo_bits, hi_bits), _mm_setzero_si128());
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(outside));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t self_loop_run_avx2(const unsigned char *lo, const unsigned char *hi, const char *data, size_t length)
+{
+    // PSHUFB works within each 128-bit lane, so both lanes get a copy of the tables.
+    const __m256i lo_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(lo)));
+    const __m256i hi_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hi)));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        __m256i lo_bits = _mm256_shuffle_epi8(lo_table, _mm256_and_si256(bytes, nibble));
+        __m256i hi_bits = _mm256_shuffle_epi8(hi_table, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble));
+        __m256i outside = _mm256_cmpeq_epi8(_mm256_and_si256(lo_bits, hi_bits), _mm256_setzero_si256());
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(outside));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    return i + self_loop_run_ssse3(lo, hi, data + i, length - i);
+}
+#endif
+
+size_t DFA::self_loop_run(const self_loop_t &loop, const char *data, size_t length)
+{
+    size_t i = 0;
+#ifdef DFA_X86_SIMD
+    if (length >= 16)
+    {
+        int level = dfa_simd_level();
+        if (level == 2)
+            i = self_loop_run_avx2(loop.lo, loop.hi, data, length);
+        else if (level == 1)
+            i = self_loop_run_ssse3(loop.lo, loop.hi, data, length);
+        if (i + 16 <= length && level != 0)
+            return i; // stopped inside a full block: data[i] leaves the set
+    }
+#endif
+    while (i < length)
+    {
+        unsigned char ch = static_cast<unsigned char>(data[i]);
+        if (!((loop.member[ch >> 6] >> (ch & 63)) & 1))
             break;
+        i++;
     }
+    return i;
+}
+// Table walk from start_pos, starting in state; returns the index where it stopped and leaves
+// the last state in state. A state that has just taken self_loop_streak self-transitions in a row is in a long
+// run, and the rest of the run is skipped with self_loop_run; short tokens never pay for it.
+size_t DFA::walk(const char *data, size_t length, size_t start_pos, int &state) const
+{
+    const size_t self_loop_streak = 8;
+    const int *rows = table.data();
+    const int *classes = byte_class.data();
+    size_t i = start_pos;
+    size_t streak = 0;
+    while (i < length)
+    {
+        int target = rows[state * class_count + classes[static_cast<unsigned char>(data[i])]];
+        if (target < 0)
+            break;
+        i++;
+        if (target != state)
+        {
+            streak = 0;
+            state = target;
+        }
+        else if (++streak == self_loop_streak)
+        {
+            streak = 0;
+            if (loop_index[state] >= 0)
+                i += self_loop_run(self_loops[loop_index[state]], data + i, length - i);
+        }
+    }
+    return i;
+}
+size_t DFA::longest_match(const std::string& input, size_t start_pos)
+{
+    if (finals.empty() || start_pos >= input.length())
+        return 0;
+    int state = 0;
+    size_t matched_length = walk(input.data(), input.length(), start_pos, state) - start_pos;
 
+#ifdef DFA_STATS
+    dfa_stats_t &stats = thread_stats();
+    stats.runs++;
+    stats.transitions += matched_length;
+#endif
     return matched_length;
 }
 bool DFA::all_match(const std::string& input, size_t start_pos)
 {
-    auto current_states = start_state;
-    bool matched = 0;
+    if (finals.empty())
+        return 0;
+    int state = 0;
+    size_t end = start_pos < input.length() ? walk(input.data(), input.length(), start_pos, state) : start_pos;
 
-    for (size_t i = start_pos; i < input.length(); i++)
+#ifdef DFA_STATS
+    dfa_stats_t &stats = thread_stats();
+    stats.runs++;
+    stats.transitions += end > start_pos ? end - start_pos : 0;
+#endif
+    return end >= input.length() && finals[state];
+}
+std::vector<bool> DFA::all_match_batch(const std::string *inputs, size_t count) const
+{
+    // Strings are taken a window at a time (small enough that the window stays in cache),
+    // bucketed by length inside the window and then walked `lanes` at a time, so a block's
+    // lanes are about equally long. Each round every lane takes one step; once the shortest
+    // lane is done, lanes past their end read the hold column (every row maps to itself).
+    // A lane that failed sits in the dead row. The inner loop has no per-lane branches and
+    // the lanes' table loads are independent, so their latencies overlap.
+    const size_t lanes = 8;     // more lanes than this spills the row registers
+    const size_t window = 512;
+    const size_t buckets = 64; // longer strings share the last bucket
+    std::vector<bool> matched(count, false);
+    if (finals.empty())
+        return matched;
+    const int hold = static_cast<int>(class_count), accept = hold + 1;
+    const int *rows = lockstep_table.data();
+    const int *classes = byte_class.data();
+    size_t bucket_start[buckets + 1];
+    unsigned order[window];
+    unsigned char result[window];
+    for (size_t base = 0; base < count; base += window)
     {
-        auto valid_transfers = current_states -> transfers.equal_range(input[i]);
-        matched = 0;
-        for (auto transfer = valid_transfers.first; transfer != valid_transfers.second; transfer++)
+        const size_t size = std::min(window, count - base);
+        std::fill(bucket_start, bucket_start + buckets + 1, 0);
+        for (size_t i = 0; i < size; i++)
+            bucket_start[std::min(inputs[base + i].length(), buckets - 1) + 1]++;
+        std::partial_sum(bucket_start, bucket_start + buckets + 1, bucket_start);
+        for (size_t i = 0; i < size; i++)
+            order[bucket_start[std::min(inputs[base + i].length(), buckets - 1)]++] = static_cast<unsigned>(i);
+
+        for (size_t first = 0; first < size; first += lanes)
         {
-            auto target = transfer -> second.lock();
-            if (target)
+            const size_t block = std::min(lanes, size - first);
+            const unsigned char *data[lanes];
+            size_t length[lanes];
+            int row[lanes];
+            size_t shortest = SIZE_MAX, longest = 0;
+            for (size_t k = 0; k < lanes; k++)
             {
-                current_states = target;
-                matched = 1;
-                break;
+                // Short final block: the spare lanes walk an empty string and are never read back.
+                const std::string &input = inputs[base + order[first + (k < block ? k : 0)]];
+                data[k] = reinterpret_cast<const unsigned char *>(input.data());
+                length[k] = k < block ? input.length() : 0;
+                row[k] = 0;
+                shortest = std::min(shortest, length[k]);
+                longest = std::max(longest, length[k]);
+            }
+            size_t s = 0;
+            for (; s < shortest; s++)
+            {
+                for (size_t k = 0; k < lanes; k++)
+                    row[k] = rows[row[k] + classes[data[k][s]]];
+            }
+            for (; s < longest; s++)
+            {
+                for (size_t k = 0; k < lanes; k++)
+                {
+                    bool inside = s < length[k];
+                    int column = inside ? classes[data[k][inside ? s : 0]] : hold;
+                    row[k] = rows[row[k] + column];
+                }
             }
+            for (size_t k = 0; k < block; k++)
+                result[order[first + k]] = static_cast<unsigned char>(rows[row[k] + accept]);
         }
-        if (matched == 0)
-            return 0;
-        matched = 0;
+        for (size_t i = 0; i < size; i++)
+            matched[base + i] = result[i] != 0;
     }
+#ifdef DFA_STATS
+    dfa_stats_t &stats = thread_stats();
+    stats.runs += count;
+    for (size_t i = 0; i < count; i++)
+        stats.transitions += inputs[i].length();
+#endif
+    return matched;
+}
+std::vector<bool> DFA::all_match_batch(const std::vector<std::string> &inputs) const
+{
+    return all_match_batch(inputs.data(), inputs.size());
+}
+std::vector<int> DFA::segment_map(const char *data, size_t begin, size_t end) const
+{
+    // Walks data[begin, end) from every state at once and returns, per starting state, the state
+    // it ends in (-1 if its walk dies). Walks that reach the same state merge, since they share
+    // the rest of the segment. Most merge within a few bytes, so the first bytes are stepped one
+    // at a time with a merge after each. Some never merge (a run of decimal digits keeps the
+    // integer, octal, float and exponent states apart), so after that the survivors run in
+    // lockstep on the lockstep table: every lane reads the same byte class and their loads are
+    // independent, which makes k walks cost far less than k serial walks. Merges are checked
+    // again after every block. A single survivor finishes with the plain walk.
+    const size_t warmup = 64, block = 4096;
+    const size_t n = owned_states.size();
+    const size_t stride = class_count + 2;
+    const int dead = static_cast<int>(n * stride);
+    std::vector<int> active(n), next;
+    std::vector<int> slot_of(n); // starting state -> index into active, -1 once its walk died
+    std::iota(active.begin(), active.end(), 0);
+    std::iota(slot_of.begin(), slot_of.end(), 0);
+    std::vector<size_t> seen(n, 0);
+    std::vector<int> slot_in_next(n), remap;
+    size_t generation = 0;
+    // targets[k] is where active[k] went (-1 if it died); merges equal targets, drops dead ones.
+    auto settle = [&](const std::vector<int> &targets) {
+        generation++;
+        next.clear();
+        remap.assign(active.size(), -1);
+        for (size_t k = 0; k < active.size(); k++)
+        {
+            int target = targets[k];
+            if (target < 0)
+                continue;
+            if (seen[target] != generation)
+            {
+                seen[target] = generation;
+                slot_in_next[target] = static_cast<int>(next.size());
+                next.push_back(target);
+            }
+            remap[k] = slot_in_next[target];
+        }
+        if (next.size() != active.size()) // otherwise every walk kept its slot
+        {
+            for (int &slot : slot_of)
+            {
+                if (slot >= 0)
+                    slot = remap[slot];
+            }
+        }
+        active.swap(next);
+    };
 
-    return current_states -> is_final;
+    std::vector<int> targets;
+    size_t i = begin;
+    for (; i < end && i - begin < warmup && active.size() > 1; i++)
+    {
+        const int cls = byte_class[static_cast<unsigned char>(data[i])];
+        targets.resize(active.size());
+        for (size_t k = 0; k < active.size(); k++)
+            targets[k] = table[active[k] * class_count + cls];
+        settle(targets);
+    }
+    std::vector<int> rows;
+    while (i < end && active.size() > 1)
+    {
+        const size_t stop = std::min(end, i + block);
+        rows.resize(active.size());
+        for (size_t k = 0; k < active.size(); k++)
+            rows[k] = active[k] * static_cast<int>(stride);
+        for (; i < stop; i++)
+        {
+            const int cls = byte_class[static_cast<unsigned char>(data[i])];
+            for (int &row : rows)
+                row = lockstep_table[row + cls];
+        }
+        targets.resize(active.size());
+        for (size_t k = 0; k < active.size(); k++)
+            targets[k] = rows[k] == dead ? -1 : rows[k] / static_cast<int>(stride);
+        settle(targets);
+    }
+    if (active.size() == 1 && i < end)
+    {
+        if (walk(data, end, i, active[0]) < end)
+            active.clear();
+    }
+    std::vector<int> result(n, -1);
+    for (size_t q = 0; q < n && !active.empty(); q++)
+    {
+        if (slot_of[q] >= 0)
+            result[q] = active[slot_of[q]];
+    }
+    return result;
+}
+bool DFA::all_match_parallel(const std::string &input, size_t threads, size_t start_pos)
+{
+    // Below this many bytes per segment, starting threads costs more than it saves.
+    const size_t min_segment = 1 << 20;
+    if (finals.empty())
+        return false;
+    const size_t length = input.length();
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t segments = start_pos < length ? std::min(threads, (length - start_pos) / min_segment) : 0;
+    if (segments <= 1)
+        return all_match(input, start_pos);
+
+    const size_t segment_length = (length - start_pos) / segments;
+    std::vector<std::future<std::vector<int>>> maps;
+    for (size_t k = 1; k < segments; k++)
+    {
+        size_t begin = start_pos + k * segment_length;
+        size_t end = k + 1 == segments ? length : begin + segment_length;
+        maps.push_back(std::async(std::launch::async, [this, &input, begin, end]() {
+            return segment_map(input.data(), begin, end);
+        }));
+    }
+    // The first segment only ever starts from the start state.
+    int state = 0;
+    bool alive = walk(input.data(), start_pos + segment_length, start_pos, state) == start_pos + segment_length;
+    for (auto &map : maps)
+    {
+        std::vector<int> mapping = map.get(); // always wait, so no thread outlives the call
+        if (alive)
+        {
+            state = mapping[state];
+            alive = state >= 0;
+        }
+    }
+
+#ifdef DFA_STATS
+    dfa_stats_t &stats = thread_stats();
+    stats.runs++;
+    stats.transitions += length - start_pos;
+#endif
+    return alive && finals[state];
+}
+int dfa_searcher::live_state(const std::vector<unsigned long long> &set)
+{
+    auto found = live_ids.find(set);
+    if (found != live_ids.end())
+        return found->second;
+    int id = static_cast<int>(live_sets.size());
+    live_ids.emplace(set, id);
+    live_sets.push_back(set);
+    live_table.resize(live_sets.size() * dfa.class_count, -1);
+    return id;
+}
+int dfa_searcher::live_step(int live, int cls)
+{
+    // Reading one byte (of class cls) to the left: a state is live before it if its transition
+    // leads into the live set, and final states are always live (a match may end here).
+    const size_t class_count = dfa.class_count;
+    int &cached = live_table[live * class_count + cls];
+    if (cached >= 0)
+        return cached;
+    const size_t n = dfa.owned_states.size();
+    std::vector<unsigned long long> set((n + 63) / 64, 0);
+    for (size_t q = 0; q < n; q++)
+    {
+        int target = dfa.table[q * class_count + cls];
+        if (dfa.finals[q] || (target >= 0 && is_live(live, target)))
+            set[q >> 6] |= 1ull << (q & 63);
+    }
+    int next = live_state(set);
+    live_table[live * class_count + cls] = next; // live_state may have moved live_table
+    return next;
+}
+void dfa_searcher::reverse_pass(const std::string &text, size_t start_pos)
+{
+    if (layout_version != dfa.layout_version)
+    {
+        // State numbers changed, so the states built so far are stale.
+        live_sets.clear();
+        live_ids.clear();
+        live_table.clear();
+        layout_version = dfa.layout_version;
+    }
+    input = &text;
+    start = start_pos;
+    const size_t n = dfa.owned_states.size();
+    const size_t length = text.length();
+    std::vector<unsigned long long> final_set((n + 63) / 64, 0);
+    for (size_t q = 0; q < n; q++)
+    {
+        if (dfa.finals[q])
+            final_set[q >> 6] |= 1ull << (q & 63);
+    }
+    // Blocks cover [start + k * block_size, start + (k + 1) * block_size], the last one ends at
+    // length; block 0 is reached last, so it is filled on the way instead of being recomputed.
+    const size_t block_count = std::max<size_t>(1, (length - start_pos + block_size - 1) / block_size);
+    checkpoints.assign(block_count + 1, -1);
+    block.resize(block_size + 1);
+    block_index = 0;
+    block_begin = start_pos;
+    const size_t first_end = std::min(start_pos + block_size, length);
+    int state = live_state(final_set);
+    checkpoints[block_count] = state;
+    if (length == first_end)
+        block[length - start_pos] = state;
+    for (size_t p = length; p-- > start_pos;)
+    {
+        state = live_step(state, dfa.byte_class[static_cast<unsigned char>(text[p])]);
+        if ((p - start_pos) % block_size == 0)
+            checkpoints[(p - start_pos) / block_size] = state;
+        if (p <= first_end)
+            block[p - start_pos] = state;
+    }
+#ifdef DFA_STATS
+    DFA::thread_stats().transitions += length - start_pos;
+#endif
+}
+void dfa_searcher::load_block(size_t index)
+{
+    // Walks right to left from the checkpoint at the end of the block; every state on the way
+    // was already built by reverse_pass, so this is one table lookup per byte.
+    const std::string &text = *input;
+    block_index = index;
+    block_begin = start + index * block_size;
+    size_t end = std::min(block_begin + block_size, text.length());
+    int state = checkpoints[index + 1];
+    block[end - block_begin] = state;
+    for (size_t p = end; p-- > block_begin;)
+    {
+        state = live_step(state, dfa.byte_class[static_cast<unsigned char>(text[p])]);
+        block[p - block_begin] = state;
+    }
+}
+bool dfa_searcher::search(size_t start_pos, dfa_match_t &match)
+{
+    // From start_pos, the first position where a step out of the start state stays live begins
+    // the leftmost match: a live target is one that reaches a final state on the rest of the
+    // input. The walk from there stops as soon as a step would leave the live set, which is
+    // right after the last final state it can reach, so it ends the longest match. A failed
+    // start costs one step and every byte of a match is walked once; positions are visited in
+    // increasing order, which is what lets live_at keep a single block.
+    const std::string &text = *input;
+    const size_t length = text.length();
+    const size_t class_count = dfa.class_count;
+    for (size_t begin = start_pos; begin < length; begin++)
+    {
+        int state = 0;
+        size_t end = begin;
+        for (size_t p = begin; p < length; p++)
+        {
+            int target = dfa.table[state * class_count + dfa.byte_class[static_cast<unsigned char>(text[p])]];
+            if (target < 0 || !is_live(live_at(p + 1), target))
+                break;
+            state = target;
+            if (dfa.finals[state])
+                end = p + 1;
+        }
+        if (end > begin)
+        {
+            match.begin = begin;
+            match.end = end;
+            return true;
+        }
+    }
+    return false;
+}
+bool dfa_searcher::find_first(const std::string &text, dfa_match_t &match, size_t start_pos)
+{
+    if (dfa.finals.empty() || start_pos >= text.length())
+        return false;
+#ifdef DFA_STATS
+    DFA::thread_stats().runs++;
+#endif
+    reverse_pass(text, start_pos);
+    return search(start_pos, match);
+}
+std::vector<dfa_match_t> dfa_searcher::find_all(const std::string &text, size_t start_pos)
+{
+    std::vector<dfa_match_t> matches;
+    if (dfa.finals.empty() || start_pos >= text.length())
+        return matches;
+#ifdef DFA_STATS
+    DFA::thread_stats().runs++;
+#endif
+    reverse_pass(text, start_pos);
+    dfa_match_t match;
+    for (size_t pos = start_pos; search(pos, match); pos = match.end)
+        matches.push_back(match);
+    return matches;
+}
+bool DFA::find_first(const std::string &input, dfa_match_t &match, size_t start_pos) const
+{
+    dfa_searcher searcher(*this);
+    return searcher.find_first(input, match, start_pos);
+}
+std::vector<dfa_match_t> DFA::find_all(const std::string &input, size_t start_pos) const
+{
+    dfa_searcher searcher(*this);
+    return searcher.find_all(input, start_pos);
+}
+#ifdef DFA_STATS
+dfa_stats_t &DFA::thread_stats()
+{
+    static thread_local dfa_stats_t stats;
+    return stats;
+}
+#endif
+void DFA::compile()
+{
+    const size_t n = owned_states.size();
+    std::unordered_map<dfa_state *, int> id_map;
+    for (size_t i = 0; i < n; i++)
+        id_map[owned_states[i].get()] = static_cast<int>(i);
+
+    // Raw rows over all 256 bytes first, then merge bytes whose columns are identical.
+    std::vector<std::vector<int>> columns(256, std::vector<int>(n, -1));
+    finals.assign(n, 0);
+    for (size_t i = 0; i < n; i++)
+    {
+        finals[i] = owned_states[i]->is_final;
+        for (const auto &tr : owned_states[i]->transfers)
+        {
+            auto target = tr.second.lock();
+            if (target)
+                columns[static_cast<unsigned char>(tr.first)][i] = id_map[target.get()];
+        }
+    }
+    std::map<std::vector<int>, int> column_ids;
+    byte_class.assign(256, 0);
+    for (int c = 0; c < 256; c++)
+    {
+        auto found = column_ids.find(columns[c]);
+        if (found == column_ids.end())
+            found = column_ids.emplace(columns[c], static_cast<int>(column_ids.size())).first;
+        byte_class[c] = found->second;
+    }
+    class_count = column_ids.size();
+    table.assign(n * class_count, -1);
+    for (int c = 0; c < 256; c++)
+    {
+        for (size_t i = 0; i < n; i++)
+            table[i * class_count + byte_class[c]] = columns[c][i];
+    }
+
+    // Lockstep table: entries are row offsets so no multiply is needed per step. Two extra
+    // columns per row: hold maps the row to itself, accept holds its final flag. One extra
+    // row (dead) absorbs failed walks.
+    const size_t stride = class_count + 2;
+    const int dead = static_cast<int>(n * stride);
+    lockstep_table.assign((n + 1) * stride, dead);
+    for (size_t i = 0; i <= n; i++)
+    {
+        for (size_t c = 0; c < class_count && i < n; c++)
+        {
+            int target = table[i * class_count + c];
+            if (target >= 0)
+                lockstep_table[i * stride + c] = target * static_cast<int>(stride);
+        }
+        lockstep_table[i * stride + class_count] = static_cast<int>(i * stride);
+        lockstep_table[i * stride + class_count + 1] = i < n && finals[i];
+    }
+
+    // State numbers changed, so searchers built on the old layout have to start over.
+    layout_version++;
+
+    // Nibble tables for self-loops: group the high nibbles by the set of low nibbles they
+    // allow; with at most 8 distinct groups, (lo[b & 15] & hi[b >> 4]) != 0 is exact.
+    loop_index.assign(n, -1);
+    self_loops.clear();
+    for (size_t i = 0; i < n; i++)
+    {
+        unsigned low_sets[16] = {};
+        bool any = false;
+        for (int c = 0; c < 256; c++)
+        {
+            if (table[i * class_count + byte_class[c]] == static_cast<int>(i))
+            {
+                low_sets[c >> 4] |= 1u << (c & 15);
+                any = true;
+            }
+        }
+        if (!any)
+            continue;
+        self_loop_t loop = {};
+        std::vector<unsigned> groups;
+        bool fits = true;
+        for (int h = 0; h < 16 && fits; h++)
+        {
+            if (low_sets[h] == 0)
+                continue;
+            size_t g = std::find(groups.begin(), groups.end(), low_sets[h]) - groups.begin();
+            if (g == groups.size())
+            {
+                if (groups.size() == 8)
+                {
+                    fits = false;
+                    break;
+                }
+                groups.push_back(low_sets[h]);
+                for (int l = 0; l < 16; l++)
+                {
+                    if (low_sets[h] >> l & 1)
+                        loop.lo[l] |= static_cast<unsigned char>(1u << g);
+                }
+            }
+            loop.hi[h] |= static_cast<unsigned char>(1u << g);
+            for (int l = 0; l < 16; l++)
+            {
+                if (low_sets[h] >> l & 1)
+                {
+                    int c = h << 4 | l;
+                    loop.member[c >> 6] |= 1ull << (c & 63);
+                }
+            }
+        }
+        if (!fits)
+            continue;
+        loop_index[i] = static_cast<int>(self_loops.size());
+        self_loops.push_back(loop);
+    }
+}
+size_t DFA::state_count() const
+{
+    return owned_states.size();
+}
+std::vector<int> DFA::bfs_order() const
+{
+    // Breadth-first from the start state, successors in byte order, so states reached
+    // together sit next to each other; unreachable states (if any) go last.
+    const size_t n = owned_states.size();
+    std::vector<int> order;
+    std::vector<bool> seen(n, false);
+    order.reserve(n);
+    if (n == 0)
+        return order;
+    order.push_back(0);
+    seen[0] = true;
+    for (size_t head = 0; head < order.size(); head++)
+    {
+        const int *row = table.data() + order[head] * class_count;
+        for (int c = 0; c < 256; c++)
+        {
+            int target = row[byte_class[c]];
+            if (target >= 0 && !seen[target])
+            {
+                seen[target] = true;
+                order.push_back(target);
+            }
+        }
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!seen[i])
+            order.push_back(static_cast<int>(i));
+    }
+    return order;
+}
+std::vector<unsigned long long> DFA::profile_transitions(const std::vector<std::string> &samples) const
+{
+    // Number of transitions leaving each state while walking every sample as far as it goes.
+    std::vector<unsigned long long> counts(owned_states.size(), 0);
+    if (owned_states.empty())
+        return counts;
+    for (const auto &sample : samples)
+    {
+        int state = 0;
+        for (char ch : sample)
+        {
+            int target = table[state * class_count + byte_class[static_cast<unsigned char>(ch)]];
+            if (target < 0)
+                break;
+            counts[state]++;
+            state = target;
+        }
+    }
+    return counts;
+}
+std::vector<int> DFA::profile_order(const std::vector<std::string> &samples) const
+{
+    // Hottest states first (after the start state); ties keep their BFS order.
+    std::vector<unsigned long long> counts = profile_transitions(samples);
+    std::vector<int> order = bfs_order();
+    if (order.size() > 1)
+    {
+        std::stable_sort(order.begin() + 1, order.end(),
+                         [&counts](int a, int b) { return counts[a] > counts[b]; });
+    }
+    return order;
+}
+void DFA::relayout(const std::vector<int> &order)
+{
+    assert(order.size() == owned_states.size());
+    assert(order.empty() || order[0] == 0);
+    std::vector<std::shared_ptr<dfa_state>> states;
+    states.reserve(order.size());
+    for (int old_id : order)
+        states.push_back(owned_states[old_id]);
+    owned_states = std::move(states);
+    compile();
 }
 DFA::~DFA()
 {
@@ -807,3 +1747,199 @@ std::string DFA::export2str()
     }
     return export_stream.str();
 }
+
+// C++ operand for byte c, as a character literal where that reads better.
+static std::string byte_literal(int c)
+{
+    if (c >= 0x20 && c < 0x7F && c != '\'' && c != '\\')
+        return std::string("'") + static_cast<char>(c) + "'";
+    return std::to_string(c);
+}
+std::string DFA::export2cpp(const std::string &name) const
+{
+    // re2c style: every state is a label; entering a final state records the match so far, and
+    // the next byte either jumps to a target state or ends the walk. States with few targets
+    // use range comparisons, self-loop first, since a switch becomes a jump table whose
+    // indirect branch mispredicts on nearly every byte; states with many targets use a switch.
+    const size_t switch_targets = 4; // more targets than this get a switch
+    const size_t n = owned_states.size();
+    std::vector<bool> targeted(n, false);
+    for (int target : table)
+    {
+        if (target >= 0)
+            targeted[target] = true;
+    }
+    std::ostringstream out;
+    out << "inline dfa_scan_result_t " << name << "(const char *data, size_t length)\n"
+        << "{\n"
+        << "    const unsigned char *const begin = reinterpret_cast<const unsigned char *>(data);\n"
+        << "    const unsigned char *const end = begin + length;\n"
+        << "    const unsigned char *p = begin;\n"
+        << "    unsigned char c;\n"
+        << "    dfa_scan_result_t res = {0, 0, -1};\n";
+    for (size_t i = 0; i < n; i++)
+    {
+        if (targeted[i])
+            out << "state_" << i << ":\n";
+        else
+            out << "    // state_" << i << "\n";
+        if (finals[i])
+            out << "    res.length = static_cast<size_t>(p - begin);\n"
+                << "    res.tag = " << i << ";\n";
+        // Byte ranges per target, the state's own loop first.
+        std::map<int, std::vector<std::pair<int, int>>> ranges_by_target;
+        for (int c = 0; c < 256; c++)
+        {
+            int target = table[i * class_count + byte_class[c]];
+            if (target < 0)
+                continue;
+            auto &ranges = ranges_by_target[target];
+            if (!ranges.empty() && ranges.back().second == c - 1)
+                ranges.back().second = c;
+            else
+                ranges.emplace_back(c, c);
+        }
+        if (ranges_by_target.empty())
+        {
+            out << "    goto done;\n";
+            continue;
+        }
+        std::vector<int> targets;
+        if (ranges_by_target.count(static_cast<int>(i)))
+            targets.push_back(static_cast<int>(i));
+        for (const auto &group : ranges_by_target)
+        {
+            if (group.first != static_cast<int>(i))
+                targets.push_back(group.first);
+        }
+        out << "    if (p == end)\n"
+            << "        goto done;\n"
+            << "    c = *p;\n";
+        if (targets.size() > switch_targets)
+        {
+            // Many targets: one indirect jump beats a long chain of data-dependent branches.
+            out << "    switch (c)\n"
+                << "    {\n";
+            for (int target : targets)
+            {
+                std::string line = "    ";
+                for (const auto &range : ranges_by_target[target])
+                {
+                    for (int b = range.first; b <= range.second; b++)
+                    {
+                        std::string label = "case " + byte_literal(b) + ":";
+                        if (line.size() + label.size() + 1 > 100)
+                        {
+                            out << line << "\n";
+                            line = "    ";
+                        }
+                        line += (line.size() > 4 ? " " : "") + label;
+                    }
+                }
+                out << line << "\n"
+                    << "        p++;\n"
+                    << "        goto state_" << target << ";\n";
+            }
+            out << "    default:\n"
+                << "        goto done;\n"
+                << "    }\n";
+            continue;
+        }
+        for (int target : targets)
+        {
+            std::string cond;
+            const auto &ranges = ranges_by_target[target];
+            for (const auto &range : ranges)
+            {
+                if (!cond.empty())
+                    cond += " || ";
+                if (range.first == range.second)
+                    cond += "c == " + byte_literal(range.first);
+                else if (ranges.size() == 1)
+                    cond += "c >= " + byte_literal(range.first) + " && c <= " + byte_literal(range.second);
+                else
+                    cond += "(c >= " + byte_literal(range.first) + " && c <= " + byte_literal(range.second) + ")";
+            }
+            out << "    if (" << cond << ")\n"
+                << "    {\n"
+                << "        p++;\n"
+                << "        goto state_" << target << ";\n"
+                << "    }\n";
+        }
+        out << "    goto done;\n";
+    }
+    out << "done:\n"
+        << "    res.walked = static_cast<size_t>(p - begin);\n"
+        << "    return res;\n"
+        << "}\n";
+    return out.str();
+}
+std::string DFA::export2table(const std::string &name, bool keep_layout) const
+{
+    const size_t n = owned_states.size();
+    // Non-final states first, then the finals, each group in layout order; the start state goes
+    // wherever that puts it. keep_layout leaves every state where it is.
+    std::vector<size_t> row(n);
+    size_t first_final = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (keep_layout)
+            row[i] = i;
+        else if (!finals[i])
+            row[i] = first_final++;
+    }
+    size_t next_row = first_final;
+    for (size_t i = 0; i < n && !keep_layout; i++)
+    {
+        if (finals[i])
+            row[i] = next_row++;
+    }
+
+    // The largest value of the state type is the dead marker, so it must exceed every row.
+    const char *state_type = "uint8_t";
+    size_t width = 1;
+    if (n > 0xFFFF)
+    {
+        state_type = "uint32_t";
+        width = 4;
+    }
+    else if (n > 0xFF)
+    {
+        state_type = "uint16_t";
+        width = 2;
+    }
+    const unsigned long long dead = width == 4 ? 0xFFFFFFFFull : (1ull << (8 * width)) - 1;
+    const bool use_classes = 256 + n * class_count * width < n * 256 * width;
+    const size_t columns = use_classes ? class_count : 256;
+
+    std::ostringstream out;
+    out << "// " << name << ": " << n << " states, " << columns << " columns of " << state_type << ", "
+        << (use_classes ? 256 : 0) + n * columns * width + (keep_layout ? n : 0) << " bytes\n";
+    auto emit_values = [&out](const char *type, const std::string &array, const std::vector<unsigned long long> &values) {
+        out << "static const " << type << " " << array << "[" << values.size() << "] = {";
+        for (size_t i = 0; i < values.size(); i++)
+            out << (i % 16 == 0 ? "\n    " : " ") << values[i] << (i + 1 < values.size() ? "," : "");
+        out << "\n};\n";
+    };
+    if (use_classes)
+        emit_values("unsigned char", name + "_classes", std::vector<unsigned long long>(byte_class.begin(), byte_class.end()));
+    std::vector<unsigned long long> cells(n * columns);
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t col = 0; col < columns; col++)
+        {
+            int target = table[i * class_count + (use_classes ? col : byte_class[col])];
+            cells[row[i] * columns + col] = target < 0 ? dead : row[target];
+        }
+    }
+    emit_values(state_type, name + "_table", cells);
+    if (keep_layout)
+        emit_values("unsigned char", name + "_finals", std::vector<unsigned long long>(finals.begin(), finals.end()));
+    std::string alphabet = use_classes ? "dfa_class_alphabet" : "dfa_byte_alphabet";
+    std::string accept = keep_layout ? "dfa_accept_flags" : "dfa_accept_tail";
+    out << "static const dfa_matcher<" << state_type << ", " << alphabet << ", " << accept << "> " << name << "(\n"
+        << "    " << name << "_table, " << row[0] << ", " << alphabet << "{"
+        << (use_classes ? name + "_classes, " + std::to_string(class_count) : "") << "}, " << accept << "{"
+        << (keep_layout ? name + "_finals" : std::to_string(first_final)) << "});\n";
+    return out.str();
+}
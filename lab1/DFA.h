@@ -1,6 +1,7 @@
 #ifndef DFA_H
 #define DFA_H
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <vector>
@@ -77,6 +78,7 @@ class NFA
     friend class DFA;
 public:
     NFA(const RE& re);
+    static NFA from_postfix(const RE& postfix_re); // Thompson construction from postfix_form()'s result
     ~NFA();
     NFA(const char terminal);
     NFA(const NFA& other);
@@ -85,9 +87,42 @@ public:
     bool concat_other(const NFA& other);
     bool kleene_star();
     bool plus();
+    // Turns the automaton into an epsilon-free NFA with merged equivalent states. Afterwards there may be
+    // several final states and final_state is null, so this is the last step before determinisation.
+    void simplify();
+    size_t state_count() const { return owned_states.size(); }
+};
+
+// Phase timings and sizes of DFA(const NFA&), filled in when a pointer is passed.
+struct dfa_build_stats_t
+{
+    size_t nfa_states = 0;        // as given
+    size_t simplified_states = 0; // after NFA::simplify
+    size_t subset_states = 0;     // after subset construction
+    size_t dfa_states = 0;        // after minimize
+    double simplify_seconds = 0;
+    double subset_seconds = 0;
+    double minimize_seconds = 0;
+    double compile_seconds = 0;   // compile() and relayout()
+};
+#endif
+
+#ifdef DFA_STATS
+// 匹配计数，每个线程各自累计，读取时不需要加锁
+struct dfa_stats_t
+{
+    unsigned long long runs = 0;        // longest_match / all_match 的调用次数
+    unsigned long long transitions = 0; // 走过的转移数
 };
 #endif
 
+// An occurrence found by find_first / find_all: input[begin, end)
+struct dfa_match_t
+{
+    size_t begin;
+    size_t end;
+};
+
 struct dfa_state
 {
     bool is_final = false;
@@ -98,7 +133,46 @@ class DFA
 {
     std::shared_ptr<dfa_state> start_state;
     std::unordered_set<char> terminal_chars;
-    std::vector<std::shared_ptr<dfa_state>> owned_states; // owns DFA states
+    std::vector<std::shared_ptr<dfa_state>> owned_states; // owns DFA states, start state first
+
+    // Compiled form used for matching, rebuilt by compile() whenever owned_states changes.
+    // Bytes with identical columns share a class; row i of the table is state owned_states[i].
+    // minimize() has removed every state that cannot reach a final one, so -1 is the only dead state.
+    std::vector<int> byte_class;      // 256 entries, byte -> column
+    size_t class_count = 0;
+    std::vector<int> table;           // owned_states.size() * class_count, -1 = no transition / dead
+    std::vector<unsigned char> finals;
+    // Lockstep form for all_match_batch: entries are row offsets, with extra hold (row maps
+    // to itself) and accept (final flag) columns and an extra dead row, so lanes never branch.
+    std::vector<int> lockstep_table;
+
+    // Self-loop acceleration: for states that stay put on a set of bytes (the digit loop of
+    // constant_dfa, the [A-Za-z0-9_] loop of identifier_dfa), the set is encoded as a pair of
+    // 16-entry nibble tables so a whole run can be skipped 16/32 bytes at a time with PSHUFB.
+    struct self_loop_t
+    {
+        unsigned char lo[16];      // bit k set: low nibble belongs to group k
+        unsigned char hi[16];      // bit k set: high nibble uses group k
+        unsigned long long member[4]; // exact 256-bit membership, for the scalar tail
+    };
+    std::vector<int> loop_index;      // per state, index into self_loops or -1
+    std::vector<self_loop_t> self_loops;
+    static size_t self_loop_run(const self_loop_t &loop, const char *data, size_t length);
+    size_t walk(const char *data, size_t length, size_t start_pos, int &state) const;
+    std::vector<int> segment_map(const char *data, size_t begin, size_t end) const;
+
+    // Bumped by every compile(), so a dfa_searcher can tell that its cached states are stale.
+    unsigned long long layout_version = 0;
+    friend class dfa_searcher;
+    void compile();
+    enum product_op_t
+    {
+        PRODUCT_UNION,
+        PRODUCT_INTERSECTION,
+        PRODUCT_DIFFERENCE,
+    };
+    DFA() = default;
+    static DFA product(const DFA &a, const DFA &b, product_op_t op);
 #ifndef DFA_ONLY
     nfa_state_set_t move(const nfa_state_set_t& states, char input);
     nfa_state_set_t epsilon_closure(const nfa_state_set_t& states);
@@ -111,10 +185,102 @@ public:
     bool all_match(const std::string& input, size_t start_pos = 0);
     size_t longest_match(const std::string& input, size_t start_pos = 0);
     std::string export2str();
+    // Directly executable form: a standalone C++ function NAME(data, length) returning a
+    // dfa_scan_result_t, with one labelled block per state branching on the next byte.
+    std::string export2cpp(const std::string &name) const;
+    // Table form for dfa_matcher (DFAMatcher.h): static arrays plus a matcher named NAME, using the
+    // narrowest state type that fits and, if smaller, a byte-class column map. Final states are
+    // renumbered to the end so acceptance is a single comparison; with keep_layout the current
+    // state order (e.g. a profile_order layout) is kept and a per-state flag array is emitted instead.
+    std::string export2table(const std::string &name, bool keep_layout = false) const;
+
+    // Set operations on the languages, by product construction over the reachable state pairs
+    // followed by minimize(); they work the same on constructed and imported DFAs. Complement
+    // is taken over all 256 byte values.
+    DFA unite(const DFA &other) const;
+    DFA intersect(const DFA &other) const;
+    DFA subtract(const DFA &other) const;
+    DFA complement() const;
+
+    // Bulk classification: advances 8 of the strings at a time together through the table so
+    // their dependent loads overlap. Bit i of the result is all_match(inputs[i]).
+    std::vector<bool> all_match_batch(const std::string *inputs, size_t count) const;
+    std::vector<bool> all_match_batch(const std::vector<std::string> &inputs) const;
+
+    // all_match for very long inputs: the input is cut into one segment per thread, every
+    // segment but the first is walked from all states at once (giving a state -> state map),
+    // and the maps are composed in order. threads = 0 uses every core; short inputs run serially.
+    bool all_match_parallel(const std::string &input, size_t threads = 0, size_t start_pos = 0);
+
+    // Unanchored search for non-empty, non-overlapping, leftmost-longest matches, from
+    // start_pos on. Linear in the length of the input. These build a temporary dfa_searcher;
+    // keep one per thread instead to reuse its states across calls.
+    bool find_first(const std::string &input, dfa_match_t &match, size_t start_pos = 0) const;
+    std::vector<dfa_match_t> find_all(const std::string &input, size_t start_pos = 0) const;
+
+    // State layout: states are renumbered before the table is emitted. Construction and
+    // import apply bfs_order(); order[i] is the current index of the state placed at i,
+    // and order[0] must be 0 (the start state stays first).
+    size_t state_count() const;
+    std::vector<int> bfs_order() const;
+    std::vector<unsigned long long> profile_transitions(const std::vector<std::string> &samples) const;
+    std::vector<int> profile_order(const std::vector<std::string> &samples) const;
+    void relayout(const std::vector<int> &order);
+#ifdef DFA_STATS
+    static dfa_stats_t &thread_stats(); // 当前线程上所有 DFA 的累计计数
+#endif
     
 #ifndef DFA_ONLY
-    DFA(const NFA& nfa);
+    DFA(const NFA& nfa, dfa_build_stats_t *stats = nullptr);
 #endif
 };
 
+// Unanchored search state for one DFA. The search runs a reverse DFA right to left first; its
+// state at position p is the set of forward states that can still reach a final state from
+// input[p]. Every final state is added at every position, which is what prefixing the reversed
+// pattern with .* does. Those states are built lazily and kept here rather than in the DFA, so
+// the DFA stays read-only: threads sharing a DFA each use their own searcher. The searcher
+// refers to the DFA, which must outlive it; it notices a relayout and starts over.
+// Only every block_size-th reverse state is kept, and a block's states are recomputed from the
+// checkpoint after it when the forward walk gets there (it only ever moves forward), so memory
+// is O(n / block_size + block_size) for an input of n bytes.
+class dfa_searcher
+{
+    const DFA &dfa;
+    unsigned long long layout_version;
+    std::vector<std::vector<unsigned long long>> live_sets; // live state -> bitset over states
+    std::map<std::vector<unsigned long long>, int> live_ids;
+    std::vector<int> live_table;  // live state * class_count + class -> live state, -1 = not built
+
+    static const size_t block_size = 4096;
+    const std::string *input = nullptr;
+    size_t start = 0;             // position of checkpoints[0]
+    std::vector<int> checkpoints; // live state at start + k * block_size, the last one at the end
+    std::vector<int> block;       // live states at block_begin .. block_begin + block_size
+    size_t block_index = 0;
+    size_t block_begin = 0;
+
+    int live_state(const std::vector<unsigned long long> &set);
+    int live_step(int live, int cls);
+    bool is_live(int live, int state) const
+    {
+        return (live_sets[live][state >> 6] >> (state & 63)) & 1;
+    }
+    void reverse_pass(const std::string &text, size_t start_pos);
+    void load_block(size_t index);
+    int live_at(size_t p)
+    {
+        size_t index = std::min((p - start) / block_size, checkpoints.size() - 2);
+        if (index != block_index)
+            load_block(index);
+        return block[p - block_begin];
+    }
+    bool search(size_t start_pos, dfa_match_t &match);
+
+public:
+    explicit dfa_searcher(const DFA &dfa) : dfa(dfa), layout_version(dfa.layout_version) {}
+    bool find_first(const std::string &input, dfa_match_t &match, size_t start_pos = 0);
+    std::vector<dfa_match_t> find_all(const std::string &input, size_t start_pos = 0);
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef DFA_MATCHER_H
+#define DFA_MATCHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// 从 data 开始沿 DFA 走到没有可用转移为止
+struct dfa_scan_result_t
+{
+    size_t length; // 最长的、停在终态上的前缀长度，没有时为 0
+    size_t walked; // 走过的字节数，与 DFA::longest_match 的返回值相同
+    int tag;       // length 对应的终态编号，没有匹配时为 -1
+};
+
+/*
+ * 编译期特化的表驱动 DFA 匹配器
+ * 状态编号的宽度（State：uint8_t / uint16_t / uint32_t）、字母表映射（Alphabet）、终态的表示（Accept）
+ * 都是模板参数，热循环里没有运行时的分支或间接调用；转移表只有 行数 × 列数 个 State，
+ * 小自动机整个只占几百字节
+ * 表由 DFA::export2table 生成为静态数组，它按状态数自动选用能放下的最窄的 State
+*/
+
+// 字母表映射：256 项的 字节 -> 列 表，列数即字节类的个数
+struct dfa_class_alphabet
+{
+    const unsigned char *classes;
+    size_t column_count;
+    size_t column(unsigned char c) const { return classes[c]; }
+    size_t columns() const { return column_count; }
+};
+
+// 每个字节单独一列：省掉一次查表，但表宽 256 列，只在字节类几乎没有合并时划算
+struct dfa_byte_alphabet
+{
+    size_t column(unsigned char c) const { return c; }
+    size_t columns() const { return 256; }
+};
+
+// 终态编号排在最后：编号 >= first 即为终态，不需要额外的表
+struct dfa_accept_tail
+{
+    size_t first;
+    bool accepts(size_t state) const { return state >= first; }
+};
+
+// 每个状态一个标志字节：不重排状态编号（保留广度优先或按转移频率的布局）时使用
+struct dfa_accept_flags
+{
+    const unsigned char *flags;
+    bool accepts(size_t state) const { return flags[state] != 0; }
+};
+
+template <class State, class Alphabet, class Accept>
+class dfa_matcher
+{
+    const State *table; // 状态 * 列数 + 列 -> 目标状态，dead 表示没有转移
+    State start;
+    Alphabet alphabet;
+    Accept accept;
+
+public:
+    static constexpr State dead = std::numeric_limits<State>::max();
+
+    constexpr dfa_matcher(const State *table, State start, Alphabet alphabet, Accept accept)
+        : table(table), start(start), alphabet(alphabet), accept(accept)
+    {
+    }
+
+    // 与 dfa_test --emit-cpp 生成的扫描函数相同；tag 为本表中的状态编号
+    dfa_scan_result_t scan(const char *data, size_t length) const
+    {
+        const unsigned char *p = reinterpret_cast<const unsigned char *>(data);
+        const size_t columns = alphabet.columns();
+        dfa_scan_result_t res = {0, 0, -1};
+        size_t state = start, i = 0;
+        while (true)
+        {
+            if (accept.accepts(state))
+            {
+                res.length = i;
+                res.tag = static_cast<int>(state);
+            }
+            if (i == length)
+                break;
+            State next = table[state * columns + alphabet.column(p[i])];
+            if (next == dead)
+                break;
+            state = next;
+            i++;
+        }
+        res.walked = i;
+        return res;
+    }
+
+    bool all_match(const char *data, size_t length) const
+    {
+        const unsigned char *p = reinterpret_cast<const unsigned char *>(data);
+        const size_t columns = alphabet.columns();
+        size_t state = start;
+        for (size_t i = 0; i < length; i++)
+        {
+            State next = table[state * columns + alphabet.column(p[i])];
+            if (next == dead)
+                return false;
+            state = next;
+        }
+        return accept.accepts(state);
+    }
+};
+
+template <class State, class Alphabet, class Accept>
+constexpr State dfa_matcher<State, Alphabet, Accept>::dead;
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef INCLUDE_CACHE_H
+#define INCLUDE_CACHE_H
+
+#include <climits>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/*
+ * 进程内的头文件缓存：规范化路径 -> 分析好的头文件
+ * 同一个头文件无论被多少个源文件、多少个线程包含，都只在第一次请求时构造一次；
+ * 其它同时请求它的线程等待第一次构造的结果
+*/
+template <class Header>
+class IncludeCache
+{
+    typedef std::shared_ptr<const Header> header_ptr;
+
+    std::mutex lock;
+    std::map<std::string, std::shared_future<header_ptr>> entries;
+
+public:
+    IncludeCache() = default;
+    IncludeCache(const IncludeCache &) = delete;
+    IncludeCache &operator=(const IncludeCache &) = delete;
+
+    /* 文件的规范化路径（解析符号链接与 ..），文件不存在时返回空串 */
+    static std::string canonical_path(const std::string &path)
+    {
+        char resolved[PATH_MAX];
+        if (!realpath(path.c_str(), resolved))
+            return "";
+        return resolved;
+    }
+
+    /*
+     * 取 canonical 对应的头文件，不在缓存中时在当前线程调用 load(canonical) 构造
+     * load 返回空指针表示文件无法读取，这个结果同样会被缓存
+    */
+    template <class Load>
+    header_ptr get(const std::string &canonical, Load &&load)
+    {
+        std::promise<header_ptr> promise;
+        std::unique_lock<std::mutex> guard(lock);
+        auto found = entries.find(canonical);
+        if (found != entries.end())
+        {
+            std::shared_future<header_ptr> pending = found->second;
+            guard.unlock(); // 等待时不占用锁，其它头文件可以同时加载
+            return pending.get();
+        }
+        entries.emplace(canonical, promise.get_future().share());
+        guard.unlock();
+        try
+        {
+            header_ptr res = load(canonical);
+            promise.set_value(res);
+            return res;
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+    }
+
+    size_t size()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return entries.size();
+    }
+};
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef KEY_MATCHER_H
+#define KEY_MATCHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <vector>
+#include "KeyTable.h"
+
+/* 关键字表中某一项在文本中的一次出现 */
+struct key_occurrence_t
+{
+    size_t position; // 起始偏移
+    int code;        // 种别码
+};
+
+/*
+ * 由关键字表构建的 Aho–Corasick 自动机，一遍扫描找出全部关键字、运算符的所有出现（包括重叠的，
+ * 例如 "<<=" 中的 "<"、"<<"、"<<=" 和 "<="，以及标识符里面的 "if"），用于代码统计
+ * 失败转移在构建时已并入转移表：每个 状态 × 字节类 都有确定的下一状态，扫描时不需要沿失败链回退；
+ * 字节类只区分在关键字中出现过的字节，表按行平铺
+ * 每个状态记录以它结尾的关键字，以及沿失败链最近的另一个有输出的状态（字典后缀链），
+ * 报告匹配时只走有输出的状态
+ * 标识符、常数、注释等种别码在表中的占位项不是字面文本，不参与匹配
+*/
+class KeyMatcher
+{
+    std::vector<unsigned char> byte_class; // 256 项，字节 -> 列，0 为不出现在任何关键字中的字节
+    size_t class_count = 1;
+    std::vector<uint32_t> delta;           // 状态 * class_count + 列 -> 下一状态，状态 0 为根
+    std::vector<int> output_code;          // 以该状态结尾的关键字的种别码，没有时为 -1
+    std::vector<uint32_t> output_length;   // 该关键字的长度
+    std::vector<int> dict_link;            // 失败链上最近的有输出的状态，没有时为 -1
+    std::vector<int> first_output;         // 自身有输出时为自身，否则同 dict_link：扫描时每个字节只查这一项
+
+public:
+    explicit KeyMatcher(const KeyTable &keys) : byte_class(256, 0)
+    {
+        std::vector<const key_entry_t *> literals;
+        for (const auto &entry : keys)
+        {
+            bool placeholder = entry.code == keys.identifier() || entry.code == keys.constant() ||
+                               entry.code == keys.comment();
+            if (entry.length == 0 || placeholder)
+                continue;
+            literals.push_back(&entry);
+            for (size_t i = 0; i < entry.length; i++)
+            {
+                unsigned char c = static_cast<unsigned char>(entry.key[i]);
+                if (byte_class[c] == 0)
+                    byte_class[c] = static_cast<unsigned char>(class_count++);
+            }
+        }
+
+        // 字典树：goto 边先写在 delta 里，缺失为 0（根）
+        auto add_state = [this]() {
+            delta.resize(delta.size() + class_count, 0);
+            output_code.push_back(-1);
+            output_length.push_back(0);
+            dict_link.push_back(-1);
+            first_output.push_back(-1);
+            return static_cast<uint32_t>(output_code.size() - 1);
+        };
+        add_state();
+        for (const key_entry_t *entry : literals)
+        {
+            uint32_t state = 0;
+            for (size_t i = 0; i < entry->length; i++)
+            {
+                size_t cls = byte_class[static_cast<unsigned char>(entry->key[i])];
+                if (delta[state * class_count + cls] == 0)
+                {
+                    uint32_t next = add_state();
+                    delta[state * class_count + cls] = next;
+                }
+                state = delta[state * class_count + cls];
+            }
+            output_code[state] = entry->code;
+            output_length[state] = static_cast<uint32_t>(entry->length);
+        }
+
+        // 按层次广度优先求失败状态，同时把缺失的 goto 边补成沿失败链得到的转移
+        std::vector<uint32_t> fail(output_code.size(), 0);
+        std::queue<uint32_t> pending;
+        for (size_t cls = 1; cls < class_count; cls++)
+        {
+            if (delta[cls] != 0)
+                pending.push(delta[cls]);
+        }
+        while (!pending.empty())
+        {
+            uint32_t state = pending.front();
+            pending.pop();
+            uint32_t f = fail[state];
+            dict_link[state] = first_output[f];
+            first_output[state] = output_code[state] >= 0 ? static_cast<int>(state) : dict_link[state];
+            for (size_t cls = 1; cls < class_count; cls++)
+            {
+                uint32_t &next = delta[state * class_count + cls];
+                if (next != 0)
+                {
+                    fail[next] = delta[f * class_count + cls];
+                    pending.push(next);
+                }
+                else
+                    next = delta[f * class_count + cls];
+            }
+        }
+    }
+
+    /* 按结束位置的顺序对每次出现调用 on_match(key_occurrence_t)；同一结束位置上长的在前 */
+    template <class OnMatch>
+    void scan(const char *data, size_t length, OnMatch &&on_match) const
+    {
+        const unsigned char *p = reinterpret_cast<const unsigned char *>(data);
+        uint32_t state = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            state = delta[state * class_count + byte_class[p[i]]];
+            int out = first_output[state];
+            while (out >= 0)
+            {
+                on_match(key_occurrence_t{i + 1 - output_length[out], output_code[out]});
+                out = dict_link[out];
+            }
+        }
+    }
+
+    std::vector<key_occurrence_t> find_all(const char *data, size_t length) const
+    {
+        std::vector<key_occurrence_t> occurrences;
+        scan(data, length, [&occurrences](const key_occurrence_t &occurrence) { occurrences.push_back(occurrence); });
+        return occurrences;
+    }
+
+    std::vector<key_occurrence_t> find_all(const std::string &text) const
+    {
+        return find_all(text.data(), text.size());
+    }
+
+    size_t state_count() const { return output_code.size(); }
+    size_t table_bytes() const { return delta.size() * sizeof(uint32_t); }
+};
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef KEY_TABLE_H
+#define KEY_TABLE_H
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/* 关键字表中的一项：关键字/运算符文本及其种别码 */
+struct key_entry_t
+{
+    const char *key;
+    size_t length;
+    int code;
+};
+
+#ifdef LEX_EMBEDDED_KEYS
+#include "c_keys_table.h" // 构建时由 gen_keys_table 根据 c_keys.txt 生成
+#endif
+
+/*
+ * 关键字/运算符表
+ * 表项按字节序升序排列且只读，查找用二分；多个分析器实例可以共享同一张表
+ * 默认使用构建时嵌入程序的 c_keys.txt，也可以在运行时从文件加载自定义词表
+*/
+class KeyTable
+{
+    const key_entry_t *entries;
+    size_t count;
+    size_t max_length;
+    int identifier_code;
+    int constant_code;
+    int comment_code;
+    int directive_code;
+    // 从文件加载时表项文本的存储
+    std::vector<std::string> owned_keys;
+    std::vector<key_entry_t> owned_entries;
+
+    static int compare(const key_entry_t &entry, const char *key, size_t length)
+    {
+        int res = memcmp(entry.key, key, std::min(entry.length, length));
+        if (res != 0)
+            return res;
+        return entry.length < length ? -1 : (entry.length > length ? 1 : 0);
+    }
+
+    void finish()
+    {
+        max_length = 0;
+        for (size_t i = 0; i < count; i++)
+            max_length = std::max(max_length, entries[i].length);
+        identifier_code = code_of("标识符");
+        constant_code = code_of("常数");
+        comment_code = code_of("/*注释*/");
+        // 预处理指令：词表中有 "#" 时用它的种别码，否则取比表中所有种别码都大的一个，
+        // 不与任何关键字、运算符或查找失败时的 0 混淆
+        directive_code = find("#", 1);
+        if (directive_code == -1)
+        {
+            directive_code = 0;
+            for (size_t i = 0; i < count; i++)
+                directive_code = std::max(directive_code, entries[i].code);
+            directive_code++;
+        }
+    }
+
+    KeyTable(const key_entry_t *entries, size_t count) : entries(entries), count(count)
+    {
+        finish();
+    }
+
+    /* 按 c_keys.txt 的格式读取："关键字 种别码"，每行一项；重复的关键字以最后一次为准 */
+    explicit KeyTable(std::istream &in) : entries(nullptr), count(0)
+    {
+        std::map<std::string, int> keys_map;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::istringstream iss(line);
+            int key;
+            std::string value;
+            if (iss >> value >> key)
+                keys_map[value] = key;
+        }
+        owned_keys.reserve(keys_map.size());
+        for (const auto &ele : keys_map)
+            owned_keys.push_back(ele.first);
+        size_t i = 0;
+        for (const auto &ele : keys_map)
+        {
+            owned_entries.push_back({owned_keys[i].c_str(), owned_keys[i].length(), ele.second});
+            i++;
+        }
+        entries = owned_entries.data();
+        count = owned_entries.size();
+        finish();
+    }
+public:
+    KeyTable(const KeyTable &) = delete;
+    KeyTable &operator=(const KeyTable &) = delete;
+
+    /* 内置词表，整个进程只构造一次 */
+    static std::shared_ptr<const KeyTable> builtin()
+    {
+#ifdef LEX_EMBEDDED_KEYS
+        static std::shared_ptr<const KeyTable> table(
+            new KeyTable(EMBEDDED_KEYS, sizeof(EMBEDDED_KEYS) / sizeof(EMBEDDED_KEYS[0])));
+#else
+        static std::shared_ptr<const KeyTable> table = []() {
+            std::shared_ptr<const KeyTable> loaded = load("c_keys.txt");
+            if (!loaded)
+            {
+                fprintf(stderr, "cannot load key table c_keys.txt\n");
+                std::istringstream empty;
+                loaded.reset(new KeyTable(empty));
+            }
+            return loaded;
+        }();
+#endif
+        return table;
+    }
+
+    /* 从文件加载自定义词表；文件无法打开、读取出错或其中没有任何表项时返回 nullptr */
+    static std::shared_ptr<const KeyTable> load(const std::string &path)
+    {
+        std::ifstream file(path);
+        if (!file)
+            return nullptr;
+        std::shared_ptr<const KeyTable> table(new KeyTable(file));
+        if (file.bad() || table->size() == 0)
+            return nullptr;
+        return table;
+    }
+
+    /* 查找种别码，不存在时返回 -1 */
+    int find(const char *key, size_t length) const
+    {
+        size_t lo = 0, hi = count;
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo) / 2;
+            int res = compare(entries[mid], key, length);
+            if (res == 0)
+                return entries[mid].code;
+            if (res < 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return -1;
+    }
+
+    bool contains(const std::string &key) const
+    {
+        return find(key.data(), key.length()) != -1;
+    }
+
+    /* 查找种别码，不存在时返回 0 */
+    int code_of(const std::string &key) const
+    {
+        int code = find(key.data(), key.length());
+        return code == -1 ? 0 : code;
+    }
+
+    const key_entry_t *begin() const { return entries; }
+    const key_entry_t *end() const { return entries + count; }
+    size_t size() const { return count; }
+    size_t longest() const { return max_length; }
+    int identifier() const { return identifier_code; }
+    int constant() const { return constant_code; }
+    int comment() const { return comment_code; }
+    int directive() const { return directive_code; }
+};
+
+#endif
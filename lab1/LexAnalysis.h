@@ -9,7 +9,19 @@
 #include <sstream>
 #include <vector>
 #include <cctype>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <set>
+#include <stdexcept>
 #include "DFA.h"
+#include "KeyTable.h"
+#include "SymbolTable.h"
+#include "TokenStream.h"
+#include "IncludeCache.h"
+#include "LineIndex.h"
+#include "ByteClass.h"
+#include "ThreadPool.h"
 #include "keys_patterns.h"
 using namespace std;
 
@@ -21,6 +33,7 @@ enum TokenType
     STRING,     // 字符串
     OPERATOR,   // 运算符
     COMMENT,    // 注释
+    DIRECTIVE,  // 预处理指令，整行作为一个单元
     UNKNOWN
 };
 
@@ -28,6 +41,213 @@ typedef TokenType token_type_id;
 typedef pair<token_type_id, std::string> token_t;
 typedef pair<int, string> resolved_token_t;
 
+const uint32_t NO_SYMBOL = 0xFFFFFFFFu;
+
+/*
+ * 带源码位置的词法单元，[begin, end) 是它在源程序中占据的字节区间
+ * 单元本身不保存文本：标识符和字符串的文本在分析器的符号表中（symbol 为编号），
+ * 去掉了行尾空白与续行符的预处理指令也是；其余单元的文本就是源程序中的 [begin, end)
+*/
+struct lexed_token_t
+{
+    size_t begin;
+    size_t end;
+    size_t scan_end; // 识别该单元时读到的最远位置（不含），其后的修改不影响它
+    TokenType type;
+    int code;        // 种别码
+    uint32_t symbol; // 文本在符号表中的编号，文本就是 [begin, end) 的单元为 NO_SYMBOL
+    bool in_string;  // 读入该单元之前是否处于字符串内部
+    bool valid_utf8; // 注释与字符串中的非 ASCII 内容是否为合法的 UTF-8，其它单元恒为 true
+
+    lexed_token_t() {} // 不初始化：并行分析先按总数分配结果数组，再由各线程填写
+};
+
+/* 一次编辑：从 offset 开始删去 removed 个字节，再插入 inserted */
+struct text_edit_t
+{
+    size_t offset;
+    size_t removed;
+    string inserted;
+};
+
+/* 增量分析的结果：原序列中从 first 起的 old_count 个单元被替换成了新序列中从 first 起的 new_count 个单元 */
+struct relex_result_t
+{
+    size_t first;
+    size_t old_count;
+    size_t new_count;
+};
+
+/* 命令行选项，由 main 解析后交给 Analysis 使用 */
+struct lex_options_t
+{
+    size_t threads = 1; // 大于 1 时启用并行分析
+    string keys_path;   // 非空时从该文件加载词表，代替内置的 c_keys.txt
+    bool stats = false; // 分析结束后把统计报告（JSON）写到 stderr，需要以 LEX_STATS 编译
+    bool directives = false;      // 识别预处理指令行
+    bool follow_includes = false; // 展开 #include "..."，隐含 directives
+    vector<string> include_dirs;  // 在包含者所在目录之后依次查找的目录
+};
+
+lex_options_t lex_options;
+
+#if defined(LEX_PROFILE) || defined(LEX_STATS)
+enum LexHandler
+{
+    HANDLE_CONSTANT,
+    HANDLE_IDENTIFIER_OR_KEYWORD,
+    HANDLE_OPERATOR,
+    HANDLE_COMMENT,
+    HANDLE_STRING_LITERAL,
+    HANDLE_DIRECTIVE,
+    HANDLER_COUNT
+};
+
+const char *const lex_handler_names[HANDLER_COUNT] = {
+    "handle_constant",
+    "handle_identifier_or_keyword",
+    "handle_operator",
+    "handle_comment",
+    "handle_string_literal",
+    "handle_directive",
+};
+#endif
+
+#ifdef LEX_PROFILE
+/* 各个 handle_* 的耗时统计，仅在定义 LEX_PROFILE 时编译进来 */
+struct lex_profile_t
+{
+    bool enabled = false; // 计时本身有开销，测吞吐量时可以关掉
+    unsigned long long calls[HANDLER_COUNT] = {};
+    unsigned long long bytes[HANDLER_COUNT] = {};
+    unsigned long long nanoseconds[HANDLER_COUNT] = {};
+};
+
+/* 在作用域结束时把调用次数、消耗的字节数和耗时记到对应的 handler 上 */
+class lex_profile_scope
+{
+    lex_profile_t &profile;
+    LexHandler handler;
+    const size_t &pos;
+    size_t start_pos;
+    std::chrono::steady_clock::time_point start;
+public:
+    lex_profile_scope(lex_profile_t &profile, LexHandler handler, const size_t &pos)
+        : profile(profile), handler(handler), pos(pos), start_pos(pos)
+    {
+        if (profile.enabled)
+            start = std::chrono::steady_clock::now();
+    }
+    ~lex_profile_scope()
+    {
+        if (!profile.enabled)
+            return;
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        profile.calls[handler]++;
+        profile.bytes[handler] += pos - start_pos;
+        profile.nanoseconds[handler] += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+};
+#define LEX_PROFILE_SCOPE(handler) lex_profile_scope profile_scope_guard(profile, handler, pos)
+#else
+#define LEX_PROFILE_SCOPE(handler)
+#endif
+
+#ifdef LEX_STATS
+/*
+ * 热路径计数，仅在定义 LEX_STATS 时编译进来；DFA 的转移数来自 DFA::thread_stats()，
+ * 因此 DFA 库也必须以 DFA_STATS 编译
+*/
+#ifndef DFA_STATS
+#error "LEX_STATS requires DFA_STATS"
+#endif
+
+const char *const token_type_names[UNKNOWN + 1] = {
+    "keyword", "identifier", "constant", "string", "operator", "comment", "directive", "unknown",
+};
+
+struct lex_stats_t
+{
+    bool enabled = false;
+    // 以下按实际做过的工作累计，并行分析时包含推测后又丢弃的部分
+    unsigned long long calls[HANDLER_COUNT] = {};
+    unsigned long long bytes[HANDLER_COUNT] = {};
+    unsigned long long dfa_transitions[HANDLER_COUNT] = {};
+    unsigned long long operator_comparisons = 0; // handle_operator 比较过的候选运算符个数
+    // 以下由最终结果统计
+    unsigned long long source_bytes = 0;
+    unsigned long long tokens[UNKNOWN + 1] = {};
+    size_t longest_token = 0;
+    size_t longest_token_offset = 0;
+    TokenType longest_token_type = UNKNOWN;
+    unsigned long long invalid_utf8_tokens = 0; // 含非法 UTF-8 的注释与字符串
+
+    void merge_work(const lex_stats_t &other)
+    {
+        for (int h = 0; h < HANDLER_COUNT; h++)
+        {
+            calls[h] += other.calls[h];
+            bytes[h] += other.bytes[h];
+            dfa_transitions[h] += other.dfa_transitions[h];
+        }
+        operator_comparisons += other.operator_comparisons;
+    }
+
+    void write_json(FILE *out) const
+    {
+        unsigned long long total_tokens = 0, total_transitions = 0;
+        for (int t = 0; t <= UNKNOWN; t++)
+            total_tokens += tokens[t];
+        for (int h = 0; h < HANDLER_COUNT; h++)
+            total_transitions += dfa_transitions[h];
+        fprintf(out, "{\n  \"bytes\": %llu,\n  \"tokens\": {\"total\": %llu", source_bytes, total_tokens);
+        for (int t = 0; t <= UNKNOWN; t++)
+            fprintf(out, ", \"%s\": %llu", token_type_names[t], tokens[t]);
+        fprintf(out, "},\n  \"handlers\": {");
+        for (int h = 0; h < HANDLER_COUNT; h++)
+        {
+            fprintf(out, "%s\n    \"%s\": {\"calls\": %llu, \"bytes\": %llu, \"dfa_transitions\": %llu}",
+                    h ? "," : "", lex_handler_names[h], calls[h], bytes[h], dfa_transitions[h]);
+        }
+        fprintf(out, "\n  },\n  \"dfa_transitions\": %llu,\n  \"operator_comparisons\": %llu,\n",
+                total_transitions, operator_comparisons);
+        fprintf(out, "  \"longest_token\": {\"length\": %zu, \"offset\": %zu, \"type\": \"%s\"},\n",
+                longest_token, longest_token_offset, token_type_names[longest_token_type]);
+        fprintf(out, "  \"invalid_utf8_tokens\": %llu\n}\n", invalid_utf8_tokens);
+    }
+};
+
+/* 在作用域结束时把调用次数、消耗的字节数和走过的 DFA 转移数记到对应的 handler 上 */
+class lex_stats_scope
+{
+    lex_stats_t &stats;
+    LexHandler handler;
+    const size_t &pos;
+    size_t start_pos;
+    unsigned long long start_transitions;
+public:
+    lex_stats_scope(lex_stats_t &stats, LexHandler handler, const size_t &pos)
+        : stats(stats), handler(handler), pos(pos), start_pos(pos), start_transitions(0)
+    {
+        if (stats.enabled)
+            start_transitions = DFA::thread_stats().transitions;
+    }
+    ~lex_stats_scope()
+    {
+        if (!stats.enabled)
+            return;
+        stats.calls[handler]++;
+        stats.bytes[handler] += pos - start_pos;
+        stats.dfa_transitions[handler] += DFA::thread_stats().transitions - start_transitions;
+    }
+};
+#define LEX_STATS_SCOPE(handler) lex_stats_scope stats_scope_guard(stats, handler, pos)
+#define LEX_STATS_ADD(field, n) (stats.enabled ? (void)(stats.field += (n)) : (void)0)
+#else
+#define LEX_STATS_SCOPE(handler)
+#define LEX_STATS_ADD(field, n) ((void)0)
+#endif
+
 /* 不要修改这个标准输入函数 */
 void read_prog(string &prog)
 {
@@ -40,6 +260,143 @@ void read_prog(string &prog)
 
 void print_single_token(const resolved_token_t token, int index);
 
+/*
+ * 词法单元输出缓冲
+ * 先把 "index: <lexeme,code>" 格式化进一块可复用的大缓冲区，攒满后再一次性 fwrite，
+ * 避免逐个单元 endl 刷新标准输出；整数转文本在栈上完成，不产生堆分配
+ * output 为 nullptr 时只在内存中累积，由调用方通过 data()/size() 取走
+*/
+class TokenWriter
+{
+private:
+    FILE *out;
+    vector<char> buffer;
+    size_t used;
+
+    void append(const char *data, size_t length)
+    {
+        if (used + length > buffer.size())
+        {
+            if (!out)
+            {
+                buffer.resize(std::max(buffer.size() * 2, used + length));
+                memcpy(buffer.data() + used, data, length);
+                used += length;
+                return;
+            }
+            flush();
+            if (length > buffer.size())
+            {
+                // 超长的单元（如大段注释）直接写出，不扩充缓冲区
+                fwrite(data, 1, length, out);
+                return;
+            }
+        }
+        memcpy(buffer.data() + used, data, length);
+        used += length;
+    }
+
+    void append_int(long long value)
+    {
+        char digits[24];
+        char *end = digits + sizeof(digits);
+        char *cur = end;
+        unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value)
+                                                 : static_cast<unsigned long long>(value);
+        do
+        {
+            *--cur = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0)
+            *--cur = '-';
+        append(cur, end - cur);
+    }
+public:
+    explicit TokenWriter(FILE *output = stdout, size_t capacity = 1 << 16)
+        : out(output), buffer(capacity), used(0) {}
+
+    ~TokenWriter()
+    {
+        flush();
+    }
+
+    void write_token(int code, const char *text, size_t length, size_t index)
+    {
+        append_int(static_cast<long long>(index));
+        append(": <", 3);
+        append(text, length);
+        append(",", 1);
+        append_int(code);
+        append(">\n", 2);
+    }
+
+    void write_token(const resolved_token_t &token, size_t index)
+    {
+        write_token(token.first, token.second.data(), token.second.size(), index);
+    }
+
+    void write_tokens(const vector<resolved_token_t> &tokens)
+    {
+        for (size_t i = 0; i < tokens.size(); i++)
+            write_token(tokens[i], i + 1);
+    }
+
+    void flush()
+    {
+        if (!out)
+            return;
+        if (used != 0)
+            fwrite(buffer.data(), 1, used, out);
+        used = 0;
+        fflush(out);
+    }
+
+    const char *data() const
+    {
+        return buffer.data();
+    }
+
+    size_t size() const
+    {
+        return used;
+    }
+
+    /* 清空已累积的内容，保留缓冲区容量 */
+    void clear()
+    {
+        used = 0;
+    }
+};
+
+TokenWriter stdout_writer;
+
+/* 把整个文件读进 buffer，读取失败时返回 false */
+bool read_source_file(const string &path, string &buffer)
+{
+    ifstream file(path, ios::binary);
+    if (!file)
+        return false;
+    file.seekg(0, ios::end);
+    streamoff size = file.tellg();
+    file.seekg(0, ios::beg);
+    buffer.resize(static_cast<size_t>(size));
+    file.read(&buffer[0], size);
+    return static_cast<bool>(file);
+}
+
+/* 缓存中的一个头文件：源程序与它的分析结果（其中的 #include 不展开，输出时再按需展开） */
+struct header_tokens_t
+{
+    string dir;      // 所在目录，用于解析它自己的 #include
+    string source;
+    vector<lexed_token_t> tokens;
+    SymbolTable symbols;
+    string once_key; // 非空表示只包含一次：#pragma once 时为路径，include guard 时为宏名
+};
+
+typedef IncludeCache<header_tokens_t> header_cache_t;
+
 #ifndef DFA_ONLY
 DFA constant_dfa = DFA(NFA(RE(EXPAND_CONSTANT_PATTERN)));
 DFA identifier_dfa = DFA(NFA(RE(EXPAND_IDENTIFIER_PATTERN)));
@@ -51,29 +408,46 @@ DFA identifier_dfa = DFA(IDENTIFIER_DFA);
 class LexAnalyser
 {
 private:
-    map<string, int> keys_map; // 关键字 -> 序号
-    vector<token_t> unresolved_tokens;
-    vector<resolved_token_t> resolved_tokens;
-    string prog;
+    shared_ptr<const KeyTable> keys; // 关键字 -> 序号
+    vector<lexed_token_t> unresolved_tokens;
+    vector<resolved_token_t> resolved_tokens; // 按需由 unresolved_tokens 生成
+    /*
+     * 增量分析的分界之后的单元，倒序存放，偏移记为到源程序末尾的距离，因此分界之前的编辑不改变它们；
+     * 此时 unresolved_tokens（与 resolved_tokens）只存分界之前的单元，访问完整结果时再接回去
+    */
+    vector<lexed_token_t> tail_tokens;
+    vector<resolved_token_t> tail_resolved; // resolved_valid 时与 tail_tokens 一一对应
+    bool resolved_valid;
+    SymbolTable symbols;                      // 标识符与字符串的驻留表
+    LineIndex lines;                          // 按需建立的行首索引
+    bool lines_valid;
+    string owned_prog;
+    const string *prog; // 指向 owned_prog，或并行分析时共享的源程序
     size_t pos;
+    size_t scan_end;       // 当前词法单元已读到的最远位置
     bool is_at_string_token;
     TokenType current_type;
+#ifdef LEX_PROFILE
+    lex_profile_t profile;
+#endif
+#ifdef LEX_STATS
+    lex_stats_t stats;
+#endif
+    bool directives;                         // 是否识别预处理指令
+    shared_ptr<header_cache_t> include_cache; // 非空时输出结果时展开 #include "..."
+    vector<string> include_dirs;
+    string source_dir;                        // 源程序所在目录
     /*
      * 获取下一个词法单元，并通过引用存储在传入的 token 参数中
      * 若此时已经到达末尾，直接返回 false 停止外部的 while 循环
     */
     bool get_next_token(token_t &token)
     {
-        if(!is_at_string_token)
-        {
-            // 跳过空白字符
-            while (pos < prog.length() && isspace(prog[pos]))
-                pos++;
-        }
-        if (pos >= prog.length())
+        skip_blank();
+        if (pos >= prog->length())
             return 0;
 
-        if (prog[pos] == '\"') {
+        if ((*prog)[pos] == '\"') {
             is_at_string_token = !is_at_string_token;
             token = {OPERATOR, "\""};
             pos++;
@@ -88,28 +462,34 @@ private:
                 return 1;
         }
 
-        if (isdigit(prog[pos]) || (prog[pos] == '.')) {
+        if (directives && (*prog)[pos] == '#' && at_line_start(pos)) {
+            current_type = DIRECTIVE;
+            token = handle_directive();
+            return 1;
+        }
+
+        if (is_digit_byte((*prog)[pos]) || ((*prog)[pos] == '.')) {
             current_type = CONSTANT;
             token = handle_constant();
             if (token.second != "")
                 return 1;
         }
 
-        if (isalpha(prog[pos]) || prog[pos] == '_') {
+        if (is_alpha_byte((*prog)[pos]) || (*prog)[pos] == '_') {
             token = handle_identifier_or_keyword();
             current_type = token.first;
             if (token.second != "")
                 return 1;
         }
 
-        if (pos + 1 < prog.length() && prog[pos] == '/' && prog[pos + 1] == '/') {
+        if (pos + 1 < prog->length() && (*prog)[pos] == '/' && (*prog)[pos + 1] == '/') {
             current_type = COMMENT;
             token = handle_comment(0);
             if (token.second != "")
                 return 1;
         }
 
-        if (pos + 1 < prog.length() && prog[pos] == '/' && prog[pos + 1] == '*') {
+        if (pos + 1 < prog->length() && (*prog)[pos] == '/' && (*prog)[pos + 1] == '*') {
             current_type = COMMENT;
             token = handle_comment(1);
             if (token.second != "")
@@ -121,13 +501,98 @@ private:
         return token.second != "";
     }
 
+    void note_scan(size_t limit)
+    {
+        if (limit > scan_end)
+            scan_end = limit;
+    }
+
+    void skip_blank()
+    {
+        if(!is_at_string_token)
+        {
+            // 跳过空白字符
+            while (pos < prog->length() && is_space_byte((*prog)[pos]))
+                pos++;
+        }
+    }
+
+    /* 一段分析结束时的状态：下一个词法单元的起点，以及此时是否在字符串内 */
+    struct lex_exit_t
+    {
+        size_t pos;
+        bool in_string;
+        bool halted; // 已到达末尾或遇到无法识别的字符，此后不再有词法单元
+    };
+    lex_exit_t last_exit; // 最近一次完整分析的结束状态
+
+    /*
+     * 从 begin 处以给定的字符串状态开始分析，直到下一个词法单元的起点落在 stop 及之后
+     * 返回时 pos 已跳过空白，可直接作为下一段的起点
+    */
+    lex_exit_t lex_range(size_t begin, size_t stop, bool in_string, vector<lexed_token_t> &out)
+    {
+        pos = begin;
+        is_at_string_token = in_string;
+        while (true)
+        {
+            skip_blank();
+            if (pos >= prog->length())
+                return {pos, is_at_string_token, true};
+            if (pos >= stop)
+                return {pos, is_at_string_token, false};
+            lexed_token_t lexed;
+            lexed.begin = pos;
+            lexed.in_string = is_at_string_token;
+            scan_end = pos + 2; // get_next_token 本身最多向后看两个字节
+            token_utf8_valid = true;
+            if (!get_next_token(token_buffer))
+                return {lexed.begin, lexed.in_string, true};
+            lexed.end = pos;
+            lexed.scan_end = scan_end;
+            lexed.valid_utf8 = token_utf8_valid;
+            lexed.type = token_buffer.first;
+            lexed.code = resolve_code(token_buffer);
+            bool interned = lexed.type == IDENTIFIER || lexed.type == STRING ||
+                            (lexed.type == DIRECTIVE && token_buffer.second.size() != lexed.end - lexed.begin);
+            lexed.symbol = interned ? symbols.intern(token_buffer.second) : NO_SYMBOL;
+            out.push_back(lexed);
+        }
+    }
+
+    token_t token_buffer; // lex_range 复用的临时单元
+    bool token_utf8_valid; // 当前单元的 UTF-8 检查结果，由注释与字符串的 handler 设置
+
+    /* 并行分析中的一个分块：从 start 处以普通状态推测分析到 stop */
+    struct lex_chunk_t
+    {
+        size_t start;
+        size_t stop;
+        vector<lexed_token_t> tokens;
+        SymbolTable symbols;     // 分块自己的符号表，拼接时并入主表
+        vector<size_t> last_use; // 分块符号表中每个符号最后一次出现的单元下标
+        lex_exit_t exit;
+#ifdef LEX_STATS
+        lex_stats_t stats;
+#endif
+        // 以下在拼接时确定
+        vector<lexed_token_t> relexed; // 与推测结果同步之前重新分析出的单元，已是主表中的编号
+        size_t first = 0;              // 从 tokens[first] 起沿用推测结果
+        bool synced = false;           // 是否沿用了推测结果
+        vector<uint32_t> remap;        // 分块符号表编号 -> 主表编号
+        size_t offset = 0;             // relexed 在结果中的起始下标
+    };
+
     token_t handle_constant()
     {
+        LEX_PROFILE_SCOPE(HANDLE_CONSTANT);
+        LEX_STATS_SCOPE(HANDLE_CONSTANT);
         const size_t start_pos = pos;
-        size_t match_length = constant_dfa.longest_match(prog, pos);
+        size_t match_length = constant_dfa.longest_match(*prog, pos);
+        note_scan(start_pos + match_length + 1);
         token_t res;
         res.first = CONSTANT;
-        res.second = prog.substr(start_pos, match_length);
+        res.second = prog->substr(start_pos, match_length);
         if (!constant_dfa.all_match(res.second))
         {
             return {UNKNOWN, ""};
@@ -138,11 +603,14 @@ private:
 
     token_t handle_identifier_or_keyword()
     {
+        LEX_PROFILE_SCOPE(HANDLE_IDENTIFIER_OR_KEYWORD);
+        LEX_STATS_SCOPE(HANDLE_IDENTIFIER_OR_KEYWORD);
         const size_t start_pos = pos;
-        size_t match_length = identifier_dfa.longest_match(prog, pos);
+        size_t match_length = identifier_dfa.longest_match(*prog, pos);
+        note_scan(start_pos + match_length + 1);
         token_t res;
-        res.second = prog.substr(start_pos, match_length);
-        if (keys_map.find(res.second) != keys_map.end()) {
+        res.second = prog->substr(start_pos, match_length);
+        if (keys->contains(res.second)) {
             res.first = KEYWORD;
         } else {
             res.first = IDENTIFIER;
@@ -153,39 +621,66 @@ private:
 
     token_t handle_comment(int type)
     {
+        LEX_PROFILE_SCOPE(HANDLE_COMMENT);
+        LEX_STATS_SCOPE(HANDLE_COMMENT);
         token_t res;
         if (type == 0) {
             // 单行注释
             size_t start_pos = pos;
             pos += 2; // 跳过 "//"
-            while (pos < prog.length() && prog[pos] != '\n') {
-                pos++;
+            if (pos < prog->length()) {
+                const void *newline = memchr(prog->data() + pos, '\n', prog->length() - pos);
+                pos = newline ? static_cast<const char *>(newline) - prog->data() : prog->length();
             }
+            token_utf8_valid = utf8_valid(prog->data() + start_pos, pos - start_pos);
             res.first = COMMENT;
-            res.second = prog.substr(start_pos, pos - start_pos);
+            res.second = prog->substr(start_pos, pos - start_pos);
+            note_scan(pos + 1);
         } else {
             // 多行注释
             size_t start_pos = pos;
             pos += 2; // 跳过 "/*"
-            while (pos + 1 < prog.length() && !(prog[pos] == '*' && prog[pos + 1] == '/')) {
+            // 用 memchr 跳到下一个 '*'，再看它后面是不是 '/'；找不到结束符时停在最后一个字节
+            const char *data = prog->data();
+            while (pos + 1 < prog->length()) {
+                const void *star = memchr(data + pos, '*', prog->length() - 1 - pos);
+                if (!star) {
+                    pos = prog->length() - 1;
+                    break;
+                }
+                pos = static_cast<const char *>(star) - data;
+                if (data[pos + 1] == '/')
+                    break;
                 pos++;
             }
-            if (pos + 1 < prog.length()) {
+            if (pos + 1 < prog->length()) {
                 pos += 2; // 跳过 "*/"
             }
+            token_utf8_valid = utf8_valid(data + start_pos, pos - start_pos);
             res.first = COMMENT;
-            res.second = prog.substr(start_pos, pos - start_pos);
+            res.second = prog->substr(start_pos, pos - start_pos);
+            note_scan(pos + 2);
         }
         return res;
     }
 
     token_t handle_string_literal() {
+        LEX_PROFILE_SCOPE(HANDLE_STRING_LITERAL);
+        LEX_STATS_SCOPE(HANDLE_STRING_LITERAL);
         token_t res;
-        
-        for (; pos < prog.length(); pos++) {
-            if (prog[pos] == '\\' && pos + 1 < prog.length()) {
+        const size_t start_pos = pos;
+        const char *data = prog->data();
+
+        for (; pos < prog->length(); pos++) {
+            // 普通字符整段复制，直到下一个反斜杠或引号
+            size_t run = find_either_byte(data + pos, prog->length() - pos, '\\', '\"');
+            res.second.append(data + pos, run);
+            pos += run;
+            if (pos >= prog->length())
+                break;
+            if ((*prog)[pos] == '\\' && pos + 1 < prog->length()) {
                 ++pos; // 跳过反斜杠
-                switch (prog[pos]) {
+                switch ((*prog)[pos]) {
                     case 'n': res.second.push_back('\n'); break;
                     case 'r': res.second.push_back('\r'); break;
                     case 't': res.second.push_back('\t'); break;
@@ -201,124 +696,836 @@ private:
                     default:
                         // 未知转义，保留原样
                         res.second.push_back('\\');
-                        res.second.push_back(prog[pos]);
+                        res.second.push_back((*prog)[pos]);
                         break;
                 }
-            } else if(prog[pos] == '\"') {
+            } else if((*prog)[pos] == '\"') {
                 break;
             } else {
-                res.second.push_back(prog[pos]);
+                res.second.push_back((*prog)[pos]);
             }
         }
 
+        note_scan(pos + 1);
+        token_utf8_valid = utf8_valid(data + start_pos, pos - start_pos);
         res.first = STRING;
         return res;
     }
 
-    token_t handle_operator()
+    /* pos 之前直到行首是否只有空白 */
+    bool at_line_start(size_t at) const
     {
-        token_t res;
-        for (auto ele = keys_map.rbegin(); ele != keys_map.rend(); ele++)
+        while (at > 0 && ((*prog)[at - 1] == ' ' || (*prog)[at - 1] == '\t'))
+            at--;
+        return at == 0 || (*prog)[at - 1] == '\n' || (*prog)[at - 1] == '\r';
+    }
+
+    /*
+     * 预处理指令：从 # 到行尾，反斜杠后紧跟 \n、\r\n 或文件末尾时续行
+     * 单元占据到行尾为止，之后从行尾继续分析；文本不含行尾的空白与续行符
+    */
+    token_t handle_directive()
+    {
+        LEX_PROFILE_SCOPE(HANDLE_DIRECTIVE);
+        LEX_STATS_SCOPE(HANDLE_DIRECTIVE);
+        const size_t start_pos = pos;
+        const size_t length = prog->length();
+        size_t text_end = pos;
+        while (pos < length && (*prog)[pos] != '\n')
         {
-            auto pattern = ele->first;
-            if (pos + pattern.length() > prog.length()) continue;
-            bool match = true;
-            for (size_t i = 0; i < pattern.length(); ++i) {
-                if (prog[pos + i] != pattern[i]) {
-                    match = false;
-                    break;
+            if ((*prog)[pos] == '\\')
+            {
+                size_t next = pos + 1;
+                if (next < length && (*prog)[next] == '\r')
+                    next++;
+                if (next >= length || (*prog)[next] == '\n')
+                {
+                    pos = std::min(next + 1, length); // 续行
+                    continue;
                 }
+                text_end = pos + 1;
             }
-            if (match)
+            else if (!is_space_byte((*prog)[pos]))
+                text_end = pos + 1;
+            pos++;
+        }
+        note_scan(pos + 1);
+        return {DIRECTIVE, prog->substr(start_pos, text_end - start_pos)};
+    }
+
+    token_t handle_operator()
+    {
+        LEX_PROFILE_SCOPE(HANDLE_OPERATOR);
+        LEX_STATS_SCOPE(HANDLE_OPERATOR);
+        token_t res;
+        note_scan(pos + keys->longest());
+        // 逆字节序遍历，较长的运算符总排在它的前缀之前
+        for (auto ele = keys->end(); ele != keys->begin();)
+        {
+            --ele;
+            if (pos + ele->length > prog->length()) continue;
+            LEX_STATS_ADD(operator_comparisons, 1);
+            if (memcmp(prog->data() + pos, ele->key, ele->length) == 0)
             {
-                pos += pattern.length();
-                res = {OPERATOR, pattern};
+                pos += ele->length;
+                res = {OPERATOR, string(ele->key, ele->length)};
                 break;
             }
         }
         return res;
     }
 
-    void resolve_tokens()
+    int resolve_code(const token_t &token)
     {
-        for (const auto &token: unresolved_tokens)
+        switch (token.first)
         {
-            switch (token.first)
-            {
-                case IDENTIFIER:
-                    resolved_tokens.push_back({keys_map["标识符"], token.second}); // 关键字
-                    break;
-                case CONSTANT:
-                    resolved_tokens.push_back({keys_map["常数"], token.second}); // 常数
-                    break;
-                case STRING:
-                    resolved_tokens.push_back({keys_map["标识符"], token.second}); // 字符串
-                    break;
-                case COMMENT:
-                    resolved_tokens.push_back({keys_map["/*注释*/"], token.second}); // 注释
-                    break;
-                default:
-                    resolved_tokens.push_back({keys_map[token.second], token.second}); // 关键字或运算符
-                    break;
-            }
+            case IDENTIFIER:
+                return keys->identifier(); // 关键字
+            case CONSTANT:
+                return keys->constant(); // 常数
+            case STRING:
+                return keys->identifier(); // 字符串
+            case COMMENT:
+                return keys->comment(); // 注释
+            case DIRECTIVE:
+                return keys->directive(); // 预处理指令
+            default:
+                return keys->code_of(token.second); // 关键字或运算符
         }
     }
-public:
-    LexAnalyser(const string &input_prog) : prog(input_prog), pos(0)
+
+    void resolve_tokens(vector<resolved_token_t> &out)
     {
-        // 初始化关键字和符号映射表
-        ifstream file("c_keys.txt");
-        string line;
-        while (getline(file, line))
+        out.reserve(out.size() + unresolved_tokens.size());
+        for (const auto &lexed: unresolved_tokens)
         {
-            istringstream iss(line);
-            int key;
-            string value;
-            if (iss >> value >> key)
-            {
-                keys_map[value] = key;
-            }
+            out.push_back(resolve_token(lexed));
+        }
+    }
+
+    /* 读完该单元之后是否处于字符串内部：只有引号会切换状态 */
+    bool in_string_after(const lexed_token_t &lexed) const
+    {
+        bool is_quote = lexed.type == OPERATOR && lexed.end - lexed.begin == 1 && (*prog)[lexed.begin] == '\"';
+        return is_quote ? !lexed.in_string : lexed.in_string;
+    }
+
+    /* 绝对偏移与到末尾的距离互换，length 为此时源程序的长度；按无符号数回绕，读过末尾的 scan_end 也能换回来 */
+    static void flip_offsets(lexed_token_t &lexed, size_t length)
+    {
+        lexed.begin = length - lexed.begin;
+        lexed.end = length - lexed.end;
+        lexed.scan_end = length - lexed.scan_end;
+    }
+
+    /* 分界前移一个单元 */
+    void move_to_tail()
+    {
+        tail_tokens.push_back(unresolved_tokens.back());
+        unresolved_tokens.pop_back();
+        flip_offsets(tail_tokens.back(), prog->length());
+        if (resolved_valid)
+        {
+            tail_resolved.push_back(std::move(resolved_tokens.back()));
+            resolved_tokens.pop_back();
+        }
+    }
+
+    /* 分界后移一个单元 */
+    void move_from_tail()
+    {
+        unresolved_tokens.push_back(tail_tokens.back());
+        tail_tokens.pop_back();
+        flip_offsets(unresolved_tokens.back(), prog->length());
+        if (resolved_valid)
+        {
+            resolved_tokens.push_back(std::move(tail_resolved.back()));
+            tail_resolved.pop_back();
+        }
+    }
+
+    /* 把分界之后的单元全部接回，之后 unresolved_tokens 即为完整结果 */
+    void join_tail()
+    {
+        unresolved_tokens.reserve(unresolved_tokens.size() + tail_tokens.size());
+        while (!tail_tokens.empty())
+            move_from_tail();
+    }
+
+    void tokenize_all()
+    {
+        join_tail();
+        last_exit = lex_range(0, prog->length(), false, unresolved_tokens);
+        resolved_valid = false;
+        lines_valid = false;
+    }
+
+    static const size_t max_include_depth = 64; // 包含链的深度上限；成环的包含在此之前就已停止
+
+    /* 跳过空白后读出一个单词（标识符字符组成） */
+    static string directive_word(const char *text, size_t length, size_t &i)
+    {
+        while (i < length && (text[i] == ' ' || text[i] == '\t'))
+            i++;
+        size_t start = i;
+        while (i < length && byte_is(text[i], BYTE_IDENT))
+            i++;
+        return string(text + start, i - start);
+    }
+
+    /* #include "name" 中的 name，其它指令返回空串 */
+    static string include_target(const char *text, size_t length)
+    {
+        size_t i = 1; // 跳过 #
+        if (directive_word(text, length, i) != "include")
+            return "";
+        while (i < length && (text[i] == ' ' || text[i] == '\t'))
+            i++;
+        if (i >= length || text[i] != '"')
+            return "";
+        size_t close = i + 1;
+        while (close < length && text[close] != '"')
+            close++;
+        return close < length ? string(text + i + 1, close - i - 1) : "";
+    }
+
+    /* 指令名与第一个参数，不是指令时都为空 */
+    static pair<string, string> directive_head(const header_tokens_t &header, const lexed_token_t &lexed)
+    {
+        if (lexed.type != DIRECTIVE)
+            return {"", ""};
+        auto text = token_text(lexed, header.source, header.symbols);
+        size_t i = 1;
+        string name = directive_word(text.first, text.second, i);
+        return {name, directive_word(text.first, text.second, i)};
+    }
+
+    /*
+     * 含有 #pragma once，或整个文件被 #ifndef X / #define X ... #endif 包围时，只包含一次
+     * 末尾的 #endif 必须正是与开头的 #ifndef 配对的那个，中间也不能有属于它的 #else / #elif，
+     * 否则（例如 #ifndef A ... #endif #ifndef B ... #endif）不算有保护
+    */
+    static string detect_once_key(const header_tokens_t &header, const string &path)
+    {
+        vector<size_t> code_tokens; // 注释以外的单元
+        for (size_t k = 0; k < header.tokens.size(); k++)
+        {
+            if (header.tokens[k].type == COMMENT)
+                continue;
+            code_tokens.push_back(k);
+            auto head = directive_head(header, header.tokens[k]);
+            if (head.first == "pragma" && head.second == "once")
+                return path;
         }
-        file.close();
+        if (code_tokens.size() < 3)
+            return "";
+        auto first = directive_head(header, header.tokens[code_tokens[0]]);
+        auto second = directive_head(header, header.tokens[code_tokens[1]]);
+        if (first.first != "ifndef" || first.second.empty() || second.first != "define" || second.second != first.second)
+            return "";
+        size_t nesting = 1; // 开头的 #ifndef 所在的条件嵌套层数
+        for (size_t k = 2; k < code_tokens.size(); k++)
+        {
+            string name = directive_head(header, header.tokens[code_tokens[k]]).first;
+            if (name == "if" || name == "ifdef" || name == "ifndef")
+                nesting++;
+            else if (nesting == 1 && (name == "else" || name == "elif"))
+                return "";
+            else if (name == "endif" && --nesting == 0)
+                return k + 1 == code_tokens.size() ? "#define " + first.second : "";
+        }
+        return "";
+    }
+
+    /* 在缓存中取头文件，第一次遇到时读入并分析 */
+    shared_ptr<const header_tokens_t> load_header(const string &canonical) const
+    {
+        return include_cache->get(canonical, [this](const string &path) -> shared_ptr<const header_tokens_t> {
+            auto header = make_shared<header_tokens_t>();
+            if (!read_source_file(path, header->source))
+                return nullptr;
+            LexAnalyser lexer(&header->source, keys);
+            lexer.directives = true;
+            lexer.tokenize();
+            header->tokens = std::move(lexer.unresolved_tokens);
+            header->symbols = std::move(lexer.symbols);
+            size_t slash = path.rfind('/');
+            header->dir = slash == 0 ? "/" : path.substr(0, slash);
+            header->once_key = detect_once_key(*header, path);
+            return header;
+        });
+    }
+
+    /* 先在 dir 再在 include_dirs 中查找被包含的文件，返回规范化路径，找不到时返回空串 */
+    string find_include(const string &dir, const string &name) const
+    {
+        if (name[0] == '/')
+            return header_cache_t::canonical_path(name);
+        string found = header_cache_t::canonical_path(dir + "/" + name);
+        for (size_t i = 0; found.empty() && i < include_dirs.size(); i++)
+            found = header_cache_t::canonical_path(include_dirs[i] + "/" + name);
+        return found;
+    }
+
+    /* include_stack 为正在展开的头文件（规范化路径），已在其中的文件再次被包含时不展开，成环的包含由此停止 */
+    template <class Visit>
+    void visit_tokens(const vector<lexed_token_t> &tokens, const string &source, const SymbolTable &table,
+                      const string &dir, set<string> &included, vector<string> &include_stack, Visit &visit) const
+    {
+        for (const auto &lexed : tokens)
+        {
+            auto text = token_text(lexed, source, table);
+            visit(lexed.code, text.first, text.second);
+            if (lexed.type != DIRECTIVE || !include_cache || include_stack.size() >= max_include_depth)
+                continue;
+            string name = include_target(text.first, text.second);
+            string path = name.empty() ? "" : find_include(dir, name);
+            if (path.empty() || std::find(include_stack.begin(), include_stack.end(), path) != include_stack.end())
+                continue;
+            shared_ptr<const header_tokens_t> header = load_header(path);
+            if (!header)
+                continue;
+            if (!header->once_key.empty() && !included.insert(header->once_key).second)
+                continue;
+            include_stack.push_back(path);
+            visit_tokens(header->tokens, header->source, header->symbols, header->dir, included, include_stack, visit);
+            include_stack.pop_back();
+        }
+    }
+public:
+    /* 关键字表默认使用内置词表，多个实例共享，构造时不再读文件 */
+    LexAnalyser(const string &input_prog, shared_ptr<const KeyTable> key_table = KeyTable::builtin())
+        : keys(std::move(key_table)), resolved_valid(false), lines_valid(false), owned_prog(input_prog), prog(&owned_prog), pos(0),
+          directives(false), source_dir(".")
+    {
         is_at_string_token = 0;
         unresolved_tokens.clear();
         resolved_tokens.clear();
     }
 
+    // 不复制源程序，直接引用调用方的缓冲区，调用方需保证其在分析期间有效
+    explicit LexAnalyser(const string *shared_prog, shared_ptr<const KeyTable> key_table = KeyTable::builtin())
+        : keys(std::move(key_table)), resolved_valid(false), lines_valid(false), prog(shared_prog), pos(0),
+          directives(false), source_dir(".")
+    {
+        is_at_string_token = 0;
+    }
+
+    LexAnalyser(const LexAnalyser &) = delete;
+    LexAnalyser &operator=(const LexAnalyser &) = delete;
+
+    /* 换一份源程序重新开始，已分配的缓冲区与单元数组容量都保留下来 */
+    void reset(const string &input_prog)
+    {
+        owned_prog.assign(input_prog);
+        reset(&owned_prog);
+    }
+
+    // 不复制源程序，调用方需保证其在分析期间有效
+    void reset(const string *shared_prog)
+    {
+        prog = shared_prog;
+        pos = 0;
+        is_at_string_token = 0;
+        unresolved_tokens.clear();
+        resolved_tokens.clear();
+        tail_tokens.clear();
+        tail_resolved.clear();
+        resolved_valid = false;
+        lines_valid = false;
+        symbols.clear();
+    }
+
+    /* reset 之后立即分析，返回结果的引用以免复制 */
+    const vector<resolved_token_t> &lex(const string &input_prog)
+    {
+        reset(input_prog);
+        tokenize_all();
+        return resolved();
+    }
+
+    const vector<resolved_token_t> &lex(const string *shared_prog)
+    {
+        reset(shared_prog);
+        tokenize_all();
+        return resolved();
+    }
+
+    /* 只做词法分析，不生成 (种别码, 文本) 形式的结果；之后可用 tokens()/print_res() 访问 */
+    void tokenize()
+    {
+        tokenize_all();
+    }
+
     vector<resolved_token_t> analyze()
     {
-        token_t token;
-        while(get_next_token(token))
+        tokenize_all();
+        vector<resolved_token_t> res;
+        resolve_tokens(res);
+        return res;
+    }
+
+    /*
+     * 增量分析：把编辑应用到源程序上，并在上一次分析得到的词法单元序列基础上只重新分析受影响的部分
+     * 从编辑点之前最后一个不受影响的单元边界开始重新分析，
+     * 一旦新单元的起点与状态和编辑区之后的某个旧单元重合，就直接沿用其余旧单元
+     * 单元序列在编辑点处分成两段（见 tail_tokens），之后的单元记的是到末尾的距离，不需要逐个平移；
+     * 每次编辑的工作量与重新分析的单元数、以及分界从上一次编辑点移过来的单元数成正比，
+     * 连续在同一处附近编辑时与文件大小无关。唯一与文件大小成正比的是源程序本身的 replace（一次 memmove）
+     * 两段在下一次访问完整结果（tokens()、resolved()、输出等）时才接回，这一步与分界之后的单元数成正比
+     * 只能用于持有源程序副本的分析器；引用外部缓冲区时抛出 std::logic_error，编辑区超出源程序时抛出 std::out_of_range
+    */
+    relex_result_t apply_edit(const text_edit_t &edit)
+    {
+        // 不合法的编辑不修改任何状态，直接抛出异常；Release 构建中同样检查
+        if (prog != &owned_prog)
+            throw std::logic_error("apply_edit: lexer does not own its source buffer");
+        if (edit.offset > owned_prog.length() || edit.removed > owned_prog.length() - edit.offset)
+            throw std::out_of_range("apply_edit: edit range is outside the source");
+        const size_t edit_end = edit.offset + edit.removed;
+
+        // 分界移到第一个识别时读到了编辑区的单元之前
+        while (!tail_tokens.empty() && owned_prog.length() - tail_tokens.back().begin < edit.offset)
+            move_from_tail();
+        while (!unresolved_tokens.empty() && unresolved_tokens.back().scan_end > edit.offset)
+            move_to_tail();
+        const size_t first = unresolved_tokens.size();
+
+        size_t old_count = 0;
+        auto drop_tail = [this, &old_count]() {
+            tail_tokens.pop_back();
+            if (resolved_valid)
+                tail_resolved.pop_back();
+            old_count++;
+        };
+        // 起点在编辑区内的旧单元不可能沿用
+        while (!tail_tokens.empty() && owned_prog.length() - tail_tokens.back().begin < edit_end)
+            drop_tail();
+
+        owned_prog.replace(edit.offset, edit.removed, edit.inserted);
+        lines_valid = false;
+        const size_t length = owned_prog.length();
+
+        lex_exit_t cur = {first > 0 ? unresolved_tokens.back().end : 0,
+                          first > 0 ? in_string_after(unresolved_tokens.back()) : false,
+                          false};
+        bool synced = false;
+        while (true)
         {
-            if (token.second != "")
-                unresolved_tokens.push_back(token);
+            cur = lex_range(cur.pos, cur.pos, cur.in_string, unresolved_tokens); // 只跳过空白
+            if (cur.halted)
+                break;
+            while (!tail_tokens.empty() && length - tail_tokens.back().begin < cur.pos)
+                drop_tail();
+            // 行首的 # 是否构成指令取决于它前面的内容，不能在这里同步
+            if (!tail_tokens.empty() && length - tail_tokens.back().begin == cur.pos &&
+                tail_tokens.back().in_string == cur.in_string && !(directives && owned_prog[cur.pos] == '#'))
+            {
+                synced = true;
+                break;
+            }
+            cur = lex_range(cur.pos, cur.pos + 1, cur.in_string, unresolved_tokens);
+            if (cur.halted)
+                break;
+        }
+        if (synced)
+            last_exit.pos += edit.inserted.length() - edit.removed; // 按无符号数回绕
+        else
+        {
+            while (!tail_tokens.empty())
+                drop_tail();
+            last_exit = cur;
+        }
+
+        if (resolved_valid)
+        {
+            for (size_t i = first; i < unresolved_tokens.size(); i++)
+                resolved_tokens.push_back(resolve_token(unresolved_tokens[i]));
+        }
+        return {first, old_count, unresolved_tokens.size() - first};
+    }
+
+    /* 完整的单元序列；增量分析之后第一次访问时把两段接回 */
+    const vector<lexed_token_t> &tokens()
+    {
+        join_tail();
+        return unresolved_tokens;
+    }
+
+    /* (种别码, 文本) 形式的结果，第一次访问时生成 */
+    const vector<resolved_token_t> &resolved()
+    {
+        join_tail();
+        if (!resolved_valid)
+        {
+            resolved_tokens.clear();
+            resolve_tokens(resolved_tokens);
+            resolved_valid = true;
         }
-        resolve_tokens();
         return resolved_tokens;
     }
 
-    void print_res()
+    /*
+     * 按列存储的结果：种别码、偏移、长度、行号各占一个数组，供只扫描种别码的后续遍历使用
+     * 行号在生成时顺带统计；返回的对象引用分析器的源程序，在下一次分析或编辑之前有效
+    */
+    TokenStream token_stream()
+    {
+        join_tail();
+        TokenStream stream(prog);
+        stream.reserve(unresolved_tokens.size());
+        const char *data = prog->data();
+        size_t line = 1, counted = 0;
+        for (const auto &lexed : unresolved_tokens)
+        {
+            line += LineIndex::count_newlines(data + counted, data + lexed.begin);
+            counted = lexed.begin;
+            stream.push_back(lexed.code, lexed.begin, lexed.end - lexed.begin, line);
+        }
+        return stream;
+    }
+
+    /* 行首偏移索引，第一次查询位置时才建立，源程序改变后重建 */
+    const LineIndex &line_index()
+    {
+        if (!lines_valid)
+        {
+            lines.build(prog->data(), prog->size());
+            lines_valid = true;
+        }
+        return lines;
+    }
+
+    /* 源程序中 offset 处的行号与列号，用于报告单元 [begin, end) 的位置 */
+    source_position_t position_of(size_t offset)
+    {
+        return line_index().locate(offset);
+    }
+
+    const SymbolTable &symbol_table() const
+    {
+        return symbols;
+    }
+
+    /* 单元的文本：起始指针与长度，在下一次分析或编辑之前有效 */
+    pair<const char *, size_t> token_text(const lexed_token_t &lexed) const
+    {
+        return token_text(lexed, *prog, symbols);
+    }
+
+    static pair<const char *, size_t> token_text(const lexed_token_t &lexed, const string &source, const SymbolTable &table)
+    {
+        if (lexed.symbol != NO_SYMBOL)
+            return table.text(lexed.symbol);
+        return {source.data() + lexed.begin, lexed.end - lexed.begin};
+    }
+
+    /* 识别以 # 开头的预处理指令行；关闭时 # 与原来一样按运算符处理 */
+    void enable_directives(bool on)
+    {
+        directives = on;
+    }
+
+    /*
+     * 输出结果时展开 #include "..."（隐含 enable_directives）
+     * 先在包含者所在目录查找，再依次查找 dirs；头文件经 cache 分析，同一个 cache 中每个头文件只分析一次
+     * cache 按路径缓存，共享同一个 cache 的分析器应使用同一张词表
+    */
+    void follow_includes(shared_ptr<header_cache_t> cache, vector<string> dirs = {})
+    {
+        directives = true;
+        include_cache = std::move(cache);
+        include_dirs = std::move(dirs);
+    }
+
+    /* 设置源程序的路径，#include 相对它所在的目录解析 */
+    void set_source_path(const string &path)
     {
-        for (size_t i = 0; i < resolved_tokens.size(); i++)
+        size_t slash = path.rfind('/');
+        source_dir = slash == string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    }
+
+    resolved_token_t resolve_token(const lexed_token_t &lexed) const
+    {
+        auto text = token_text(lexed);
+        return {lexed.code, string(text.first, text.second)};
+    }
+
+    const string &source() const
+    {
+        return *prog;
+    }
+
+#ifdef LEX_PROFILE
+    lex_profile_t &get_profile()
+    {
+        return profile;
+    }
+#endif
+
+#ifdef LEX_STATS
+    /* 设置 enabled 后开始计数；按单元类型的计数与最长单元在每次读取时由当前结果重新统计 */
+    lex_stats_t &get_stats()
+    {
+        stats.source_bytes = prog->length();
+        fill(begin(stats.tokens), end(stats.tokens), 0);
+        stats.longest_token = 0;
+        stats.longest_token_offset = 0;
+        stats.longest_token_type = UNKNOWN;
+        stats.invalid_utf8_tokens = 0;
+        join_tail();
+        for (const auto &lexed : unresolved_tokens)
         {
-            print_single_token(resolved_tokens[i], i + 1);
+            stats.tokens[lexed.type]++;
+            stats.invalid_utf8_tokens += !lexed.valid_utf8;
+            if (lexed.end - lexed.begin > stats.longest_token)
+            {
+                stats.longest_token = lexed.end - lexed.begin;
+                stats.longest_token_offset = lexed.begin;
+                stats.longest_token_type = lexed.type;
+            }
         }
+        return stats;
+    }
+#endif
+
+    /*
+     * 并行分析
+     * 把源程序切成若干块，每块从块内第一个换行之后以普通状态推测分析；
+     * 再按顺序拼接：前一块的结束位置与状态若与本块某个词法单元的起点吻合，直接接上，
+     * 否则从前一块的结束处重新分析，直到与推测结果重新同步（或越过本块）为止
+     * 串行的部分只有逐块确定同步点与最后重建符号表的哈希槽：各块用到的符号按哈希值分片，
+     * 每片在一个线程中去重；单元的复制与符号编号的替换也按块并行，直接写到结果中预先算好的位置
+     * 结果与 tokenize() 逐字节一致（符号的编号可能不同），之后可用 tokens()/print_res() 访问
+    */
+    void tokenize_parallel(size_t thread_count)
+    {
+        const size_t min_chunk_size = 1 << 18;
+        const size_t length = prog->length();
+        size_t chunk_count = std::min(thread_count * 4, length / min_chunk_size);
+        if (thread_count <= 1 || chunk_count <= 1)
+            return tokenize_all();
+        resolved_valid = false;
+        lines_valid = false;
+
+        vector<lex_chunk_t> chunks(chunk_count);
+        for (size_t i = 0; i < chunk_count; i++)
+        {
+            size_t boundary = length / chunk_count * i;
+            chunks[i].stop = (i + 1 == chunk_count) ? length : length / chunk_count * (i + 1);
+            // 从块内第一个换行之后开始推测，词法单元跨行的情况远少于跨块边界
+            size_t newline = (i == 0) ? string::npos : prog->find('\n', boundary);
+            chunks[i].start = (newline != string::npos && newline < chunks[i].stop) ? newline + 1 : boundary;
+        }
+
+        ThreadPool pool(thread_count);
+        auto run_parallel = [&pool](size_t count, const function<void(size_t)> &work) {
+            vector<future<void>> pending;
+            pending.reserve(count);
+            for (size_t i = 0; i < count; i++)
+                pending.push_back(pool.submit([i, &work] { work(i); }));
+            for (auto &task : pending)
+                task.get();
+        };
+
+        run_parallel(chunk_count, [this, &chunks](size_t i) {
+            lex_chunk_t &chunk = chunks[i];
+            LexAnalyser worker(prog, keys);
+            worker.directives = directives;
+#ifdef LEX_STATS
+            worker.stats.enabled = stats.enabled;
+#endif
+            chunk.exit = worker.lex_range(chunk.start, chunk.stop, false, chunk.tokens);
+            chunk.symbols = std::move(worker.symbols);
+            chunk.last_use.assign(chunk.symbols.size(), 0);
+            for (size_t k = 0; k < chunk.tokens.size(); k++)
+            {
+                if (chunk.tokens[k].symbol != NO_SYMBOL)
+                    chunk.last_use[chunk.tokens[k].symbol] = k;
+            }
+            chunk.remap.assign(chunk.symbols.size(), NO_SYMBOL);
+#ifdef LEX_STATS
+            chunk.stats = worker.stats;
+#endif
+        });
+#ifdef LEX_STATS
+        for (const auto &chunk : chunks)
+            stats.merge_work(chunk.stats);
+#endif
+
+        // 第 0 块的起点就是真实起点，推测结果即为正确结果；重新分析出的单元的符号暂时驻留在 symbols 中
+        symbols.clear();
+        chunks[0].synced = true;
+        lex_exit_t cur = chunks[0].exit;
+        size_t total = chunks[0].tokens.size();
+        for (size_t i = 1; i < chunk_count; i++)
+        {
+            lex_chunk_t &chunk = chunks[i];
+            chunk.offset = total;
+            while (!cur.halted && cur.pos < chunk.stop) // 否则上一个词法单元已经覆盖了整个块
+            {
+                size_t &idx = chunk.first;
+                while (idx < chunk.tokens.size() && chunk.tokens[idx].begin < cur.pos)
+                    idx++;
+                if (idx < chunk.tokens.size() && chunk.tokens[idx].begin == cur.pos &&
+                    chunk.tokens[idx].in_string == cur.in_string)
+                {
+                    chunk.synced = true;
+                    cur = chunk.exit;
+                    break;
+                }
+                // 推测的起始状态不对，逐个单元重新分析直到重新同步
+                cur = lex_range(cur.pos, cur.pos + 1, cur.in_string, chunk.relexed);
+            }
+            total += chunk.relexed.size() + (chunk.synced ? chunk.tokens.size() - chunk.first : 0);
+        }
+        last_exit = cur;
+
+        // 沿用部分引用的符号按哈希值分片，同一文本总落在同一片中，各片去重后首尾相接即为主表
+        SymbolTable relex_symbols;
+        std::swap(symbols, relex_symbols);
+        vector<uint32_t> relex_remap(relex_symbols.size(), NO_SYMBOL);
+        const size_t shard_count = thread_count;
+        auto shard_of = [shard_count](uint32_t h) {
+            return static_cast<size_t>((static_cast<uint64_t>(h) * shard_count) >> 32); // 用高位，片内的哈希槽仍然均匀
+        };
+        vector<SymbolTable> shards(shard_count);
+        run_parallel(shard_count, [&](size_t s) {
+            for (uint32_t id = 0; id < relex_symbols.size(); id++)
+            {
+                if (shard_of(relex_symbols.hash(id)) != s)
+                    continue;
+                auto text = relex_symbols.text(id);
+                relex_remap[id] = shards[s].intern(text.first, text.second);
+            }
+            for (auto &chunk : chunks)
+            {
+                for (uint32_t id = 0; chunk.synced && id < chunk.symbols.size(); id++)
+                {
+                    if (chunk.last_use[id] < chunk.first || shard_of(chunk.symbols.hash(id)) != s)
+                        continue;
+                    auto text = chunk.symbols.text(id);
+                    chunk.remap[id] = shards[s].intern(text.first, text.second);
+                }
+            }
+        });
+        vector<uint32_t> bases;
+        symbols = SymbolTable::concat(shards, bases);
+        vector<SymbolTable>().swap(shards);
+        auto to_global = [&bases, &shard_of](vector<uint32_t> &remap, const SymbolTable &local) {
+            for (uint32_t id = 0; id < remap.size(); id++)
+            {
+                if (remap[id] != NO_SYMBOL)
+                    remap[id] += bases[shard_of(local.hash(id))];
+            }
+        };
+        to_global(relex_remap, relex_symbols);
+
+        // 各块把单元复制到结果中的位置，同时换成主表中的编号
+        vector<lexed_token_t> merged(total);
+        run_parallel(chunk_count, [&](size_t i) {
+            lex_chunk_t &chunk = chunks[i];
+            to_global(chunk.remap, chunk.symbols);
+            lexed_token_t *out = merged.data() + chunk.offset;
+            for (const auto &lexed : chunk.relexed)
+            {
+                *out = lexed;
+                if (out->symbol != NO_SYMBOL)
+                    out->symbol = relex_remap[out->symbol];
+                out++;
+            }
+            for (size_t k = chunk.first; chunk.synced && k < chunk.tokens.size(); k++)
+            {
+                *out = chunk.tokens[k];
+                if (out->symbol != NO_SYMBOL)
+                    out->symbol = chunk.remap[out->symbol];
+                out++;
+            }
+            chunk = lex_chunk_t(); // 尽早释放
+        });
+        unresolved_tokens.swap(merged);
+        tail_tokens.clear();
+        tail_resolved.clear();
+    }
+
+    /* 并行分析并生成 (种别码, 文本) 形式的结果，与 analyze() 逐字节一致 */
+    vector<resolved_token_t> analyze_parallel(size_t thread_count)
+    {
+        tokenize_parallel(thread_count);
+        vector<resolved_token_t> res;
+        resolve_tokens(res);
+        return res;
+    }
+
+    /*
+     * 按顺序对每个单元调用 visit(种别码, 文本指针, 文本长度)
+     * 启用了 follow_includes 时，#include "..." 指令之后紧接着访问被包含文件的单元（递归展开）；
+     * 带 #pragma once 或 include guard 的头文件在一次展开中只出现一次；没有保护的头文件相互包含时，
+     * 包含链上已经在展开的文件不再展开
+    */
+    template <class Visit>
+    void for_each_token(Visit &&visit)
+    {
+        join_tail();
+        set<string> included;
+        vector<string> include_stack;
+        visit_tokens(unresolved_tokens, *prog, symbols, source_dir, included, include_stack, visit);
+    }
+
+    /* 把结果按 "序号: <文本,种别码>" 格式写入 writer，直接取单元文本，不生成中间结果 */
+    void write_tokens(TokenWriter &writer)
+    {
+        size_t index = 0;
+        for_each_token([&writer, &index](int code, const char *text, size_t length) {
+            writer.write_token(code, text, length, ++index);
+        });
+    }
+
+    void print_res()
+    {
+        write_tokens(stdout_writer);
+        stdout_writer.flush();
     }
 };
 
 void print_single_token(const resolved_token_t token, int index)
 {
-    cout << index << ": <" << token.second << "," << token.first << ">" << endl;
+    stdout_writer.write_token(token, index);
 }
 
-void Analysis()
+/* 返回进程的退出码 */
+int Analysis()
 {
+    shared_ptr<const KeyTable> keys = lex_options.keys_path.empty() ? KeyTable::builtin() : KeyTable::load(lex_options.keys_path);
+    if (!keys)
+    {
+        fprintf(stderr, "cannot load key table %s\n", lex_options.keys_path.c_str());
+        return 1;
+    }
     string prog;
     read_prog(prog);
     /********* Begin *********/
 
-    LexAnalyser lexer(prog);
-    lexer.analyze();
+    LexAnalyser lexer(&prog, keys); // prog 在整个分析期间有效，不必复制
+    lexer.enable_directives(lex_options.directives);
+    if (lex_options.follow_includes)
+        lexer.follow_includes(make_shared<header_cache_t>(), lex_options.include_dirs);
+#ifdef LEX_STATS
+    lexer.get_stats().enabled = lex_options.stats;
+#else
+    if (lex_options.stats)
+        fprintf(stderr, "--stats: this build was compiled without LEX_STATS (configure with -DLEX_STATS=ON)\n");
+#endif
+    // print_res 直接取单元文本输出，不需要 (种别码, 文本) 形式的结果
+    if (lex_options.threads > 1)
+        lexer.tokenize_parallel(lex_options.threads);
+    else
+        lexer.tokenize();
 
     lexer.print_res();/********* End *********/
+#ifdef LEX_STATS
+    if (lex_options.stats)
+        lexer.get_stats().write_json(stderr);
+#endif
+    return 0;
 }
@@ -0,0 +1,97 @@
+#ifndef LINE_INDEX_H
+#define LINE_INDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* 源码位置，行号与列号都从 1 开始，列号按字节计 */
+struct source_position_t
+{
+    size_t line;
+    size_t column;
+};
+
+/*
+ * 行首偏移索引
+ * 一次扫描记下每一行的起始偏移，之后 offset -> (行, 列) 只需在其上二分查找
+ * 词法单元只需保存偏移，需要报告位置时再查询，分析的热循环里不做任何行号记录
+*/
+class LineIndex
+{
+    std::vector<size_t> line_starts; // 第 i 行（从 0 计）的起始偏移，第 0 项恒为 0
+
+#ifdef __SSE2__
+    static unsigned newline_mask(const char *p)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'))));
+    }
+#endif
+
+public:
+    LineIndex() : line_starts(1, 0) {}
+
+    explicit LineIndex(const std::string &source) : line_starts(1, 0)
+    {
+        build(source.data(), source.size());
+    }
+
+    /* [begin, end) 中换行符的个数，每次比较 16 个字节 */
+    static size_t count_newlines(const char *begin, const char *end)
+    {
+        size_t count = 0;
+#ifdef __SSE2__
+        for (; end - begin >= 16; begin += 16)
+            count += __builtin_popcount(newline_mask(begin));
+#endif
+        for (; begin < end; begin++)
+            count += *begin == '\n';
+        return count;
+    }
+
+    void build(const char *data, size_t length)
+    {
+        line_starts.assign(1, 0);
+        line_starts.reserve(count_newlines(data, data + length) + 1);
+        size_t i = 0;
+#ifdef __SSE2__
+        for (; i + 16 <= length; i += 16)
+        {
+            // 逐个取出掩码中置位的比特，对应块内换行符的位置
+            for (unsigned mask = newline_mask(data + i); mask != 0; mask &= mask - 1)
+                line_starts.push_back(i + __builtin_ctz(mask) + 1);
+        }
+#endif
+        for (; i < length; i++)
+        {
+            if (data[i] == '\n')
+                line_starts.push_back(i + 1);
+        }
+    }
+
+    size_t line_count() const
+    {
+        return line_starts.size();
+    }
+
+    /* 第 line 行（从 1 开始）的起始偏移 */
+    size_t line_start(size_t line) const
+    {
+        return line_starts[line - 1];
+    }
+
+    /* offset 所在的行号与列号 */
+    source_position_t locate(size_t offset) const
+    {
+        size_t line = std::upper_bound(line_starts.begin(), line_starts.end(), offset) - line_starts.begin();
+        return {line, offset - line_starts[line - 1] + 1};
+    }
+};
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * 符号驻留表
+ * 每个不同的文本只保存一次，并分配一个从 0 开始的稠密编号，之后可以直接按编号比较符号
+ * 所有文本首尾相接地追加在同一块 arena 中，只增不删；查找用开放寻址哈希表
+ * 注意 intern 可能使 arena 重新分配，之前 text() 取得的指针随之失效
+*/
+class SymbolTable
+{
+    std::string arena;
+    std::vector<size_t> starts;   // 第 i 个符号在 arena 中的起点，末尾多存一个哨兵
+    std::vector<uint32_t> hashes; // 第 i 个符号的哈希值，用于快速比较与扩容
+    std::vector<uint32_t> slots;  // 哈希槽，存 编号 + 1，0 表示空槽
+
+    static uint32_t hash_of(const char *data, size_t length)
+    {
+        // FNV-1a
+        uint32_t h = 2166136261u;
+        for (size_t i = 0; i < length; i++)
+        {
+            h ^= static_cast<unsigned char>(data[i]);
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    void grow()
+    {
+        std::vector<uint32_t> bigger(slots.empty() ? 64 : slots.size() * 2, 0);
+        size_t mask = bigger.size() - 1;
+        for (uint32_t id = 0; id < hashes.size(); id++)
+        {
+            size_t i = hashes[id] & mask;
+            while (bigger[i] != 0)
+                i = (i + 1) & mask;
+            bigger[i] = id + 1;
+        }
+        slots.swap(bigger);
+    }
+public:
+    SymbolTable() : starts(1, 0) {}
+
+    /* 返回 text 对应的编号，第一次出现时追加到 arena 中 */
+    uint32_t intern(const char *data, size_t length)
+    {
+        if ((hashes.size() + 1) * 2 > slots.size())
+            grow();
+        uint32_t h = hash_of(data, length);
+        size_t mask = slots.size() - 1;
+        size_t i = h & mask;
+        while (slots[i] != 0)
+        {
+            uint32_t id = slots[i] - 1;
+            if (hashes[id] == h && starts[id + 1] - starts[id] == length &&
+                memcmp(arena.data() + starts[id], data, length) == 0)
+                return id;
+            i = (i + 1) & mask;
+        }
+        uint32_t id = static_cast<uint32_t>(hashes.size());
+        arena.append(data, length);
+        starts.push_back(arena.size());
+        hashes.push_back(h);
+        slots[i] = id + 1;
+        return id;
+    }
+
+    uint32_t intern(const std::string &text)
+    {
+        return intern(text.data(), text.length());
+    }
+
+    /* 编号对应的文本：起始指针与长度 */
+    std::pair<const char *, size_t> text(uint32_t id) const
+    {
+        return {arena.data() + starts[id], starts[id + 1] - starts[id]};
+    }
+
+    std::string str(uint32_t id) const
+    {
+        return std::string(arena.data() + starts[id], starts[id + 1] - starts[id]);
+    }
+
+    size_t size() const
+    {
+        return hashes.size();
+    }
+
+    /* 编号对应文本的哈希值 */
+    uint32_t hash(uint32_t id) const
+    {
+        return hashes[id];
+    }
+
+    /*
+     * 把若干张表首尾相接合成一张，第 k 张表中的编号 i 在结果中为 bases[k] + i
+     * 各表之间不能有相同的文本（例如按哈希值分片后分别驻留的结果），因此不再比较文本，只重建哈希槽
+    */
+    static SymbolTable concat(const std::vector<SymbolTable> &parts, std::vector<uint32_t> &bases)
+    {
+        SymbolTable res;
+        size_t arena_size = 0, count = 0;
+        for (const auto &part : parts)
+        {
+            arena_size += part.arena.size();
+            count += part.size();
+        }
+        res.arena.reserve(arena_size);
+        res.starts.reserve(count + 1);
+        res.hashes.reserve(count);
+        bases.clear();
+        for (const auto &part : parts)
+        {
+            bases.push_back(static_cast<uint32_t>(res.hashes.size()));
+            size_t shift = res.arena.size();
+            res.arena += part.arena;
+            for (size_t id = 0; id < part.size(); id++)
+                res.starts.push_back(shift + part.starts[id + 1]);
+            res.hashes.insert(res.hashes.end(), part.hashes.begin(), part.hashes.end());
+        }
+        size_t slot_count = 64;
+        while ((count + 1) * 2 > slot_count)
+            slot_count *= 2;
+        res.slots.assign(slot_count, 0);
+        size_t mask = slot_count - 1;
+        for (uint32_t id = 0; id < count; id++)
+        {
+            size_t i = res.hashes[id] & mask;
+            while (res.slots[i] != 0)
+                i = (i + 1) & mask;
+            res.slots[i] = id + 1;
+        }
+        return res;
+    }
+
+    /* 占用的字节数（按容量计） */
+    size_t memory_usage() const
+    {
+        return arena.capacity() + starts.capacity() * sizeof(size_t) +
+               (hashes.capacity() + slots.capacity()) * sizeof(uint32_t);
+    }
+
+    /* 清空所有符号，保留已分配的容量 */
+    void clear()
+    {
+        arena.clear();
+        starts.assign(1, 0);
+        hashes.clear();
+        std::fill(slots.begin(), slots.end(), 0);
+    }
+};
+
+#endif
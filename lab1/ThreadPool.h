@@ -0,0 +1,93 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/*
+ * 固定大小的线程池
+ * submit 提交的任务按先进先出顺序被空闲线程取走，返回的 future 用于取回结果
+ * 析构时等待队列中剩余任务全部完成
+*/
+class ThreadPool
+{
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    bool stopping = false;
+
+    void worker_loop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex);
+                queue_cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty())
+                    return;
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+public:
+    explicit ThreadPool(size_t thread_count)
+    {
+        if (thread_count == 0)
+            thread_count = 1;
+        workers.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; i++)
+            workers.emplace_back([this] { worker_loop(); });
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            stopping = true;
+        }
+        queue_cv.notify_all();
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    size_t size() const
+    {
+        return workers.size();
+    }
+
+    template <typename F>
+    auto submit(F &&func) -> std::future<decltype(func())>
+    {
+        typedef decltype(func()) result_t;
+        auto task = std::make_shared<std::packaged_task<result_t()>>(std::forward<F>(func));
+        std::future<result_t> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            tasks.push([task] { (*task)(); });
+        }
+        queue_cv.notify_one();
+        return result;
+    }
+
+    /* 取硬件线程数，无法探测时退化为 1 */
+    static size_t default_size()
+    {
+        size_t n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+};
+
+#endif
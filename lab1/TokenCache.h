@@ -0,0 +1,320 @@
+#ifndef TOKEN_CACHE_H
+#define TOKEN_CACHE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utime.h>
+#include <vector>
+
+/*
+ * 跨进程持久化的词法分析结果缓存
+ * 每个输入的结果按 (内容哈希, 配置哈希) 存成缓存目录下的一个文件，内容相同的文件（不论路径）共用一项；
+ * 配置哈希由调用者给出，应覆盖一切影响结果的东西（词表、DFA、分析选项、本格式的版本），
+ * 任何一项变化后旧的缓存项自然不再命中
+ * 单元序列以紧凑的二进制形式保存：文本就是源程序中一段的单元只记 (偏移差, 长度)，其它的（如转义后的
+ * 字符串）才保存文本本身；命中时先完整解码校验，再一次性交给调用者，损坏的文件当作未命中
+ * 写入先写临时文件再 rename，多个线程、多个进程同时使用同一个目录是安全的
+ * 命中时更新文件的修改时间，evict() 按修改时间从旧到新删除，直到总大小不超过上限（近似 LRU）
+*/
+
+/* 64 位内容哈希，每次处理 8 个字节 */
+inline uint64_t cache_hash(const void *data, size_t length, uint64_t seed = 0)
+{
+    const uint64_t k1 = 0x9E3779B97F4A7C15ull, k2 = 0xC2B2AE3D27D4EB4Full;
+    auto fmix = [](uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        return h ^ (h >> 33);
+    };
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    uint64_t h = fmix(seed + k1) ^ (length * k2);
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, p + i, 8);
+        h = ((h << 27) | (h >> 37)) ^ (word * k1);
+        h *= k2;
+    }
+    uint64_t tail = 0;
+    for (size_t shift = 0; i < length; i++, shift += 8)
+        tail |= static_cast<uint64_t>(p[i]) << shift;
+    h = ((h << 27) | (h >> 37)) ^ (tail * k1);
+    return fmix(h * k2);
+}
+
+/* 一个输入的结果在缓存文件中的编码，按顺序 add 每个单元，最后交给 TokenCache::store */
+class token_cache_entry_t
+{
+    const std::string *source;
+    std::string payload;
+    uint64_t count = 0;
+    uint64_t last_offset = 0;
+
+    void put_varint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            payload.push_back(static_cast<char>(value | 0x80));
+            value >>= 7;
+        }
+        payload.push_back(static_cast<char>(value));
+    }
+    static uint64_t zigzag(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+    friend class TokenCache;
+
+public:
+    explicit token_cache_entry_t(const std::string &source) : source(&source) {}
+
+    /* 追加一个单元；begin 为它在源程序中的起始偏移，文本与源程序该处相同时只记偏移 */
+    void add(int code, const char *text, size_t length, size_t begin)
+    {
+        const char *at = source->data() + begin;
+        bool in_source = begin <= source->size() && length <= source->size() - begin &&
+                         (text == at || memcmp(text, at, length) == 0);
+        put_varint(zigzag(code));
+        put_varint(static_cast<uint64_t>(length) << 1 | (in_source ? 0 : 1));
+        if (in_source)
+        {
+            uint64_t offset = begin;
+            put_varint(zigzag(static_cast<int64_t>(offset - last_offset)));
+            last_offset = offset;
+        }
+        else
+            payload.append(text, length);
+        count++;
+    }
+};
+
+class TokenCache
+{
+    struct header_t
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t config_hash;
+        uint64_t content_hash;  // 种子为 1 的内容哈希，与文件名里的种子 0 哈希一起校验内容
+        uint64_t content_size;
+        uint64_t token_count;
+        uint64_t payload_size;
+    };
+    static const uint32_t format_version = 1;
+
+    std::string dir;
+    uint64_t config_hash;
+    size_t max_bytes;
+    std::atomic<size_t> hit_count{0};
+    std::atomic<size_t> miss_count{0};
+
+    std::string entry_path(const std::string &source) const
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "/%016llx%016llx.tok", static_cast<unsigned long long>(config_hash),
+                 static_cast<unsigned long long>(cache_hash(source.data(), source.size())));
+        return dir + name;
+    }
+
+    static bool get_varint(const char *&p, const char *end, uint64_t &value)
+    {
+        value = 0;
+        for (int shift = 0; p < end && shift < 64; shift += 7)
+        {
+            unsigned char byte = static_cast<unsigned char>(*p++);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+    static int64_t unzigzag(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+public:
+    /* max_bytes：evict() 后缓存目录中 .tok 文件的总大小上限 */
+    TokenCache(const std::string &dir, uint64_t config_hash, size_t max_bytes)
+        : dir(dir), config_hash(config_hash), max_bytes(max_bytes)
+    {
+        mkdir(dir.c_str(), 0777);
+    }
+    TokenCache(const TokenCache &) = delete;
+    TokenCache &operator=(const TokenCache &) = delete;
+
+    /* 命中时按顺序对每个单元调用 visit(种别码, 文本指针, 文本长度) 并返回 true；未命中时不调用 visit */
+    template <class Visit>
+    bool lookup(const std::string &source, Visit &&visit)
+    {
+        std::string path = entry_path(source);
+        std::ifstream file(path, std::ios::binary);
+        std::string data;
+        if (file)
+        {
+            std::ostringstream content;
+            content << file.rdbuf();
+            data = content.str();
+        }
+        header_t header;
+        bool valid = data.size() >= sizeof(header);
+        if (valid)
+        {
+            memcpy(&header, data.data(), sizeof(header));
+            valid = memcmp(header.magic, "LXTC", 4) == 0 && header.version == format_version &&
+                    header.config_hash == config_hash && header.content_size == source.size() &&
+                    header.payload_size == data.size() - sizeof(header) &&
+                    header.content_hash == cache_hash(source.data(), source.size(), 1);
+        }
+        struct decoded_t
+        {
+            int code;
+            const char *text;
+            size_t length;
+        };
+        std::vector<decoded_t> tokens;
+        if (valid)
+        {
+            tokens.reserve(static_cast<size_t>(std::min<uint64_t>(header.token_count, header.payload_size)));
+            const char *p = data.data() + sizeof(header), *end = data.data() + data.size();
+            uint64_t offset = 0;
+            for (uint64_t i = 0; valid && i < header.token_count; i++)
+            {
+                uint64_t code, length_flag, delta;
+                valid = get_varint(p, end, code) && get_varint(p, end, length_flag);
+                if (!valid)
+                    break;
+                uint64_t length = length_flag >> 1;
+                if (length_flag & 1)
+                {
+                    valid = length <= static_cast<uint64_t>(end - p);
+                    if (valid)
+                        tokens.push_back({static_cast<int>(unzigzag(code)), p, static_cast<size_t>(length)});
+                    p += valid ? length : 0;
+                }
+                else
+                {
+                    valid = get_varint(p, end, delta);
+                    offset += static_cast<uint64_t>(unzigzag(delta));
+                    valid = valid && offset <= source.size() && length <= source.size() - offset;
+                    if (valid)
+                        tokens.push_back({static_cast<int>(unzigzag(code)), source.data() + offset,
+                                          static_cast<size_t>(length)});
+                }
+            }
+            valid = valid && p == end;
+        }
+        if (!valid)
+        {
+            miss_count++;
+            return false;
+        }
+        hit_count++;
+        utime(path.c_str(), nullptr);
+        for (const auto &token : tokens)
+            visit(token.code, token.text, token.length);
+        return true;
+    }
+
+    void store(const std::string &source, const token_cache_entry_t &entry)
+    {
+        header_t header;
+        memcpy(header.magic, "LXTC", 4);
+        header.version = format_version;
+        header.config_hash = config_hash;
+        header.content_hash = cache_hash(source.data(), source.size(), 1);
+        header.content_size = source.size();
+        header.token_count = entry.count;
+        header.payload_size = entry.payload.size();
+
+        std::string path = entry_path(source);
+        std::ostringstream tmp_name;
+        tmp_name << path << "." << getpid() << "-" << std::this_thread::get_id() << ".tmp";
+        std::string tmp = tmp_name.str();
+        {
+            std::ofstream file(tmp, std::ios::binary);
+            file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file.write(entry.payload.data(), static_cast<std::streamsize>(entry.payload.size()));
+            if (!file)
+            {
+                file.close();
+                remove(tmp.c_str());
+                return;
+            }
+        }
+        if (rename(tmp.c_str(), path.c_str()) != 0)
+            remove(tmp.c_str());
+    }
+
+    /* 按修改时间从旧到新删除缓存项，直到总大小不超过 max_bytes；返回删除的项数 */
+    size_t evict()
+    {
+        struct file_t
+        {
+            std::string path;
+            time_t mtime;
+            size_t size;
+        };
+        std::vector<file_t> files;
+        size_t total = 0;
+        time_t now = time(nullptr);
+        DIR *handle = opendir(dir.c_str());
+        if (!handle)
+            return 0;
+        while (dirent *entry = readdir(handle))
+        {
+            std::string name = entry->d_name;
+            bool is_entry = name.size() > 4 && name.compare(name.size() - 4, 4, ".tok") == 0;
+            bool is_tmp = name.size() > 4 && name.compare(name.size() - 4, 4, ".tmp") == 0;
+            struct stat info;
+            std::string path = dir + "/" + name;
+            if ((!is_entry && !is_tmp) || stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode))
+                continue;
+            if (is_tmp)
+            {
+                // 写到一半就退出的进程留下的临时文件，一小时后清理
+                if (info.st_mtime < now - 3600)
+                    remove(path.c_str());
+            }
+            else
+            {
+                files.push_back({path, info.st_mtime, static_cast<size_t>(info.st_size)});
+                total += static_cast<size_t>(info.st_size);
+            }
+        }
+        closedir(handle);
+        std::sort(files.begin(), files.end(), [](const file_t &a, const file_t &b) { return a.mtime < b.mtime; });
+        size_t removed = 0;
+        for (const auto &file : files)
+        {
+            if (total <= max_bytes)
+                break;
+            if (remove(file.path.c_str()) == 0 || errno == ENOENT)
+            {
+                total -= file.size;
+                removed++;
+            }
+        }
+        return removed;
+    }
+
+    size_t hits() const { return hit_count; }
+    size_t misses() const { return miss_count; }
+};
+
+#endif
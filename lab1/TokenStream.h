@@ -0,0 +1,123 @@
+#ifndef TOKEN_STREAM_H
+#define TOKEN_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/*
+ * 按列存储的词法单元序列
+ * 种别码、源码偏移、长度、行号各自放在一个连续数组里，只看种别码的遍历（语法分析、统计）
+ * 可以顺序扫过一块紧凑的 int 数组，而不必跳过每个单元的 std::string
+ * 单元文本就是源程序中的 [offset, offset + length)，源程序由调用者保证在使用期间有效
+ * 注意字符串单元的 text() 是未处理转义的原文，转义后的内容在分析器的符号表中
+*/
+class TokenStream
+{
+    const std::string *source;
+    std::vector<int> code_array;
+    std::vector<size_t> offset_array;
+    std::vector<uint32_t> length_array;
+    std::vector<uint32_t> line_array; // 从 1 开始
+
+public:
+    /* 迭代器解引用得到的代理对象，按下标从各列读取 */
+    class token_ref
+    {
+        const TokenStream *stream;
+        size_t index;
+
+    public:
+        token_ref(const TokenStream *stream, size_t index) : stream(stream), index(index) {}
+
+        int code() const { return stream->code_array[index]; }
+        size_t offset() const { return stream->offset_array[index]; }
+        size_t length() const { return stream->length_array[index]; }
+        size_t line() const { return stream->line_array[index]; }
+        const char *data() const { return stream->source->data() + offset(); }
+        std::string text() const { return std::string(data(), length()); }
+    };
+
+    class const_iterator
+    {
+        const TokenStream *stream;
+        size_t index;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef token_ref value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef token_ref reference;
+
+        const_iterator() : stream(nullptr), index(0) {}
+        const_iterator(const TokenStream *stream, size_t index) : stream(stream), index(index) {}
+
+        token_ref operator*() const { return token_ref(stream, index); }
+        token_ref operator[](difference_type n) const { return token_ref(stream, index + n); }
+
+        const_iterator &operator++() { index++; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; index++; return old; }
+        const_iterator &operator--() { index--; return *this; }
+        const_iterator operator--(int) { const_iterator old = *this; index--; return old; }
+        const_iterator &operator+=(difference_type n) { index += n; return *this; }
+        const_iterator &operator-=(difference_type n) { index -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(stream, index + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(stream, index - n); }
+        difference_type operator-(const const_iterator &other) const
+        {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const const_iterator &other) const { return index == other.index; }
+        bool operator!=(const const_iterator &other) const { return index != other.index; }
+        bool operator<(const const_iterator &other) const { return index < other.index; }
+        bool operator>(const const_iterator &other) const { return index > other.index; }
+        bool operator<=(const const_iterator &other) const { return index <= other.index; }
+        bool operator>=(const const_iterator &other) const { return index >= other.index; }
+    };
+
+    explicit TokenStream(const std::string *source = nullptr) : source(source) {}
+
+    void reserve(size_t count)
+    {
+        code_array.reserve(count);
+        offset_array.reserve(count);
+        length_array.reserve(count);
+        line_array.reserve(count);
+    }
+
+    void push_back(int code, size_t offset, size_t length, size_t line)
+    {
+        code_array.push_back(code);
+        offset_array.push_back(offset);
+        length_array.push_back(static_cast<uint32_t>(length));
+        line_array.push_back(static_cast<uint32_t>(line));
+    }
+
+    void clear()
+    {
+        code_array.clear();
+        offset_array.clear();
+        length_array.clear();
+        line_array.clear();
+    }
+
+    size_t size() const { return code_array.size(); }
+    bool empty() const { return code_array.empty(); }
+    const std::string *source_text() const { return source; }
+
+    token_ref operator[](size_t index) const { return token_ref(this, index); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    /* 直接访问各列，供只关心某一列的遍历使用 */
+    const std::vector<int> &codes() const { return code_array; }
+    const std::vector<size_t> &offsets() const { return offset_array; }
+    const std::vector<uint32_t> &lengths() const { return length_array; }
+    const std::vector<uint32_t> &lines() const { return line_array; }
+};
+
+#endif
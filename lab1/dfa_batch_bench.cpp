@@ -0,0 +1,113 @@
+// DFA 批量匹配基准测试
+// 对同一组互相独立的短字符串，比较逐个调用 all_match 与 all_match_batch（多个字符串交错前进）的吞吐量，
+// 并检查两者的结果逐位一致
+// 字符串取自数字语料中的常数；其中一部分被随机改掉一个字节，使结果里同时有匹配与不匹配
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "DFA.h"
+#include "keys_patterns.h"
+#include "CorpusGenerator.h"
+
+static std::vector<std::string> constant_literals(const std::string &corpus, uint64_t seed)
+{
+    std::vector<std::string> literals;
+    uint64_t rng = seed * 0x9E3779B97F4A7C15ull + 1;
+    bool at_token_start = true;
+    for (size_t i = 0; i < corpus.size(); i++)
+    {
+        char ch = corpus[i];
+        bool blank = ch == ' ' || ch == '\n' || ch == '\t';
+        if (at_token_start && !blank && ((ch >= '0' && ch <= '9') || ch == '.'))
+        {
+            size_t end = corpus.find_first_of(" \n\t", i);
+            literals.push_back(corpus.substr(i, end == std::string::npos ? std::string::npos : end - i));
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            if (rng % 4 == 0) // 四分之一改坏一个字节
+            {
+                std::string &literal = literals.back();
+                literal[rng / 4 % literal.size()] = "xz+-.#"[rng / 64 % 6];
+            }
+        }
+        at_token_start = blank;
+    }
+    return literals;
+}
+
+template <class Run>
+static double best_of(int repeat, Run &&run)
+{
+    double best = 0;
+    for (int r = 0; r < repeat; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (r == 0 || elapsed < best)
+            best = elapsed;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t size = 8 << 20;
+    int repeat = 5;
+    uint64_t seed = 1;
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--size") == 0 && has_value)
+            size = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--size BYTES] [--repeat N] [--seed N] [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<std::string> literals = constant_literals(CorpusGenerator(MIX_NUMERIC, seed).generate(size), seed);
+    size_t bytes = 0;
+    for (const auto &literal : literals)
+        bytes += literal.size();
+
+    DFA dfa(CONSTANT_DFA);
+    std::vector<bool> serial(literals.size()), batch;
+    double serial_seconds = best_of(repeat, [&]() {
+        for (size_t i = 0; i < literals.size(); i++)
+            serial[i] = dfa.all_match(literals[i]);
+    });
+    double batch_seconds = best_of(repeat, [&]() { batch = dfa.all_match_batch(literals); });
+    size_t matched = std::count(serial.begin(), serial.end(), true);
+    if (serial != batch)
+    {
+        fprintf(stderr, "all_match_batch disagrees with all_match\n");
+        return 1;
+    }
+
+    if (json)
+        printf("{\"strings\": %zu, \"bytes\": %zu, \"matched\": %zu, \"serial_seconds\": %.9f, "
+               "\"batch_seconds\": %.9f, \"speedup\": %.3f}\n",
+               literals.size(), bytes, matched, serial_seconds, batch_seconds, serial_seconds / batch_seconds);
+    else
+    {
+        printf("constant DFA: %zu strings (%zu matched), %zu bytes\n", literals.size(), matched, bytes);
+        printf("%-8s %9.3f ms %7.3f ns/string\n", "serial", serial_seconds * 1e3, serial_seconds * 1e9 / literals.size());
+        printf("%-8s %9.3f ms %7.3f ns/string\n", "batch", batch_seconds * 1e3, batch_seconds * 1e9 / literals.size());
+        printf("speedup  %9.2fx\n", serial_seconds / batch_seconds);
+    }
+    return 0;
+}
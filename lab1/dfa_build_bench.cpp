@@ -0,0 +1,237 @@
+// 正则 -> DFA 构造过程的基准测试
+// 模式集：keys_patterns.h 中的 CONSTANT / IDENTIFIER 定义、10 到 --max-words 个随机单词的关键字并集、
+// 多层嵌套的闭包，以及会让 DFA 指数膨胀的 (a|b)*a(a|b){n}
+// 对每个模式分别计时 RE 解析、postfix_form、Thompson NFA、NFA 化简、子集构造、最小化、编译成表，
+// 并记录各阶段的状态数与峰值内存（Linux 下为每个模式单独的峰值 RSS），以文本、CSV 或 JSON 输出
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+#include "DFA.h"
+#include "keys_patterns.h"
+
+struct build_pattern_t
+{
+    std::string name;
+    std::string definitions; // RE(std::string&) 接受的 名字 -> 表达式 定义
+};
+
+struct build_result_t
+{
+    std::string name;
+    size_t pattern_bytes = 0;
+    double parse_seconds = 0;
+    double postfix_seconds = 0;
+    double nfa_seconds = 0;
+    dfa_build_stats_t dfa; // 化简、子集构造、最小化、编译的耗时与状态数
+    long peak_rss_kb = -1; // 不支持时为 -1
+    double total_seconds() const
+    {
+        return parse_seconds + postfix_seconds + nfa_seconds + dfa.simplify_seconds + dfa.subset_seconds +
+               dfa.minimize_seconds + dfa.compile_seconds;
+    }
+};
+
+/* count 个互不相同的小写单词（3 到 10 个字母），用 | 连成一个定义 */
+static std::string keyword_alternation(size_t count, uint64_t seed)
+{
+    std::set<std::string> words;
+    uint64_t rng = seed * 0x9E3779B97F4A7C15ull + 1;
+    auto next = [&rng]() {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        return rng;
+    };
+    while (words.size() < count)
+    {
+        std::string word(3 + next() % 8, 'a');
+        for (auto &ch : word)
+            ch = static_cast<char>('a' + next() % 26);
+        words.insert(word);
+    }
+    std::string definition = "keywords ->";
+    for (const auto &word : words)
+        definition += (definition.size() > 11 ? " | " : " ") + word;
+    return definition + "\n";
+}
+
+/* ((((a*b)*c)*d)* ...)：depth 层闭包套在一起，每层一个新字母 */
+static std::string nested_stars(size_t depth)
+{
+    std::string expr = "a";
+    for (size_t i = 1; i <= depth; i++)
+        expr = "(" + expr + "*" + static_cast<char>('a' + i % 26) + ")";
+    return "nested -> " + expr + "*\n";
+}
+
+/* (a|b)*a(a|b){n}：倒数第 n + 1 个字符是 a，最小 DFA 有 2^(n+1) 个状态 */
+static std::string blowup(size_t n)
+{
+    std::string expr = "(a|b)*a";
+    for (size_t i = 0; i < n; i++)
+        expr += "(a|b)";
+    return "blowup -> " + expr + "\n";
+}
+
+static std::vector<build_pattern_t> pattern_corpus(size_t max_words, size_t max_blowup, uint64_t seed)
+{
+    std::vector<build_pattern_t> corpus = {{"constant", CONSTANT_PATTERN}, {"identifier", IDENTIFIER_PATTERN}};
+    for (size_t words = 10; words <= max_words; words *= 10)
+        corpus.push_back({"keywords_" + std::to_string(words), keyword_alternation(words, seed)});
+    for (size_t depth : {4, 16, 64})
+        corpus.push_back({"nested_" + std::to_string(depth), nested_stars(depth)});
+    for (size_t n = 4; n <= max_blowup; n += 4)
+        corpus.push_back({"blowup_" + std::to_string(n), blowup(n)});
+    return corpus;
+}
+
+#ifdef __linux__
+/* 清零本进程的峰值 RSS（VmHWM），之后读到的就是这一段代码的峰值 */
+static void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+static long peak_rss_kb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return atol(line.c_str() + 6);
+    }
+    return -1;
+}
+#else
+static void reset_peak_rss() {}
+static long peak_rss_kb() { return -1; }
+#endif
+
+template <class Run>
+static double time_of(Run &&run)
+{
+    auto start = std::chrono::steady_clock::now();
+    run();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/* 重复 repeat 次，取总耗时最短的一次的各阶段数字 */
+static build_result_t run_pattern(const build_pattern_t &pattern, int repeat)
+{
+    build_result_t best;
+    reset_peak_rss();
+    for (int r = 0; r < repeat; r++)
+    {
+        build_result_t result;
+        result.name = pattern.name;
+        result.pattern_bytes = pattern.definitions.size();
+        std::string definitions = pattern.definitions; // RE 的构造函数会改动传入的字符串
+        std::unique_ptr<RE> re, postfix;
+        std::unique_ptr<NFA> nfa;
+        result.parse_seconds = time_of([&]() { re.reset(new RE(definitions)); });
+        result.postfix_seconds = time_of([&]() { postfix.reset(new RE(re->postfix_form())); });
+        result.nfa_seconds = time_of([&]() { nfa.reset(new NFA(NFA::from_postfix(*postfix))); });
+        DFA dfa(*nfa, &result.dfa);
+        if (r == 0 || result.total_seconds() < best.total_seconds())
+            best = result;
+    }
+    best.peak_rss_kb = peak_rss_kb();
+    return best;
+}
+
+static void print_text(const build_result_t &r)
+{
+    printf("%-16s %8zu B  parse %9.3f  postfix %9.3f  nfa %9.3f  simplify %9.3f  subset %9.3f  minimize %9.3f  "
+           "compile %8.3f  total %9.3f ms\n",
+           r.name.c_str(), r.pattern_bytes, r.parse_seconds * 1e3, r.postfix_seconds * 1e3, r.nfa_seconds * 1e3,
+           r.dfa.simplify_seconds * 1e3, r.dfa.subset_seconds * 1e3, r.dfa.minimize_seconds * 1e3,
+           r.dfa.compile_seconds * 1e3, r.total_seconds() * 1e3);
+    printf("%-16s states: nfa %zu, simplified %zu, subset %zu, dfa %zu; peak rss %ld KiB\n", "", r.dfa.nfa_states,
+           r.dfa.simplified_states, r.dfa.subset_states, r.dfa.dfa_states, r.peak_rss_kb);
+}
+
+static void print_csv(const build_result_t &r)
+{
+    printf("%s,%zu,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f,%.9f,%zu,%zu,%zu,%zu,%ld\n", r.name.c_str(), r.pattern_bytes,
+           r.parse_seconds, r.postfix_seconds, r.nfa_seconds, r.dfa.simplify_seconds, r.dfa.subset_seconds,
+           r.dfa.minimize_seconds, r.dfa.compile_seconds, r.total_seconds(), r.dfa.nfa_states,
+           r.dfa.simplified_states, r.dfa.subset_states, r.dfa.dfa_states, r.peak_rss_kb);
+}
+
+static void print_json(const build_result_t &r, bool first)
+{
+    printf("%s{\"pattern\": \"%s\", \"pattern_bytes\": %zu, \"parse_seconds\": %.9f, \"postfix_seconds\": %.9f, "
+           "\"nfa_seconds\": %.9f, \"simplify_seconds\": %.9f, \"subset_seconds\": %.9f, \"minimize_seconds\": %.9f, "
+           "\"compile_seconds\": %.9f, \"total_seconds\": %.9f, \"nfa_states\": %zu, \"simplified_states\": %zu, "
+           "\"subset_states\": %zu, \"dfa_states\": %zu, \"peak_rss_kb\": %ld}",
+           first ? "" : ",\n ", r.name.c_str(), r.pattern_bytes, r.parse_seconds, r.postfix_seconds, r.nfa_seconds,
+           r.dfa.simplify_seconds, r.dfa.subset_seconds, r.dfa.minimize_seconds, r.dfa.compile_seconds,
+           r.total_seconds(), r.dfa.nfa_states, r.dfa.simplified_states, r.dfa.subset_states, r.dfa.dfa_states,
+           r.peak_rss_kb);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t max_words = 10000, max_blowup = 12;
+    int repeat = 3;
+    uint64_t seed = 1;
+    bool csv = false, json = false;
+    std::string only;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--max-words") == 0 && has_value)
+            max_words = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--max-blowup") == 0 && has_value)
+            max_blowup = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--pattern") == 0 && has_value)
+            only = argv[++i];
+        else if (strcmp(argv[i], "--csv") == 0)
+            csv = true;
+        else if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else
+        {
+            fprintf(stderr,
+                    "usage: %s [--max-words N] [--max-blowup N] [--repeat N] [--seed N] [--pattern NAME] "
+                    "[--csv | --json]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    if (csv)
+        printf("pattern,pattern_bytes,parse_seconds,postfix_seconds,nfa_seconds,simplify_seconds,subset_seconds,"
+               "minimize_seconds,compile_seconds,total_seconds,nfa_states,simplified_states,subset_states,"
+               "dfa_states,peak_rss_kb\n");
+    else if (json)
+        printf("{\"results\": [");
+    bool first = true;
+    for (const auto &pattern : pattern_corpus(max_words, max_blowup, seed))
+    {
+        if (!only.empty() && pattern.name != only)
+            continue;
+        build_result_t result = run_pattern(pattern, repeat);
+        if (csv)
+            print_csv(result);
+        else if (json)
+            print_json(result, first);
+        else
+            print_text(result);
+        fflush(stdout);
+        first = false;
+    }
+    if (json)
+        printf("]}\n");
+    return 0;
+}
@@ -0,0 +1,154 @@
+// 生成代码与查表 DFA 的对比基准测试
+// 在合成语料中每个常量 / 标识符单元的起始位置，分别调用 DFA::longest_match（查表）、
+// dfa_test --emit-cpp 生成的 scan_constant / scan_identifier（每个状态一段带标号的代码）
+// 与生成的 constant_matcher / identifier_matcher（按状态数选用最窄状态类型的 dfa_matcher），
+// 比较吞吐量，并检查三者走过的长度、是否停在终态上完全一致
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "DFA.h"
+#include "keys_patterns.h"
+#include "CorpusGenerator.h"
+#include "dfa_scanners.h"
+
+/* 语料中首字符满足 starts_token 的单元的起始位置 */
+template <class Pred>
+static std::vector<size_t> token_starts(const std::string &corpus, Pred starts_token)
+{
+    std::vector<size_t> starts;
+    bool at_token_start = true;
+    for (size_t i = 0; i < corpus.size(); i++)
+    {
+        char ch = corpus[i];
+        bool blank = ch == ' ' || ch == '\n' || ch == '\t';
+        if (at_token_start && !blank && starts_token(ch))
+            starts.push_back(i);
+        at_token_start = blank;
+    }
+    return starts;
+}
+
+template <class Run>
+static double best_of(int repeat, Run &&run)
+{
+    double best = 0;
+    for (int r = 0; r < repeat; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (r == 0 || elapsed < best)
+            best = elapsed;
+    }
+    return best;
+}
+
+/* 三种实现逐个位置对比，并分别计时；不一致时返回 false。scan、matcher 作为模板参数传入，便于内联 */
+template <class Scan, class Matcher>
+static bool compare(const char *name, DFA &dfa, Scan scan, const Matcher &matcher, const std::string &corpus,
+                    const std::vector<size_t> &starts, int repeat, bool json, bool first)
+{
+    for (size_t pos : starts)
+    {
+        dfa_scan_result_t res = scan(corpus.data() + pos, corpus.size() - pos);
+        dfa_scan_result_t matched = matcher.scan(corpus.data() + pos, corpus.size() - pos);
+        size_t walked = dfa.longest_match(corpus, pos);
+        bool final = dfa.all_match(corpus.substr(pos, walked));
+        if (res.walked != walked || (res.length == walked) != final)
+        {
+            fprintf(stderr, "%s: generated scanner disagrees with the table at offset %zu\n", name, pos);
+            return false;
+        }
+        if (matched.walked != walked || matched.length != res.length)
+        {
+            fprintf(stderr, "%s: dfa_matcher disagrees with the table at offset %zu\n", name, pos);
+            return false;
+        }
+    }
+
+    size_t table_bytes = 0, generated_bytes = 0;
+    double table_seconds = best_of(repeat, [&]() {
+        table_bytes = 0;
+        for (size_t pos : starts)
+            table_bytes += dfa.longest_match(corpus, pos);
+    });
+    double generated_seconds = best_of(repeat, [&]() {
+        generated_bytes = 0;
+        for (size_t pos : starts)
+            generated_bytes += scan(corpus.data() + pos, corpus.size() - pos).walked;
+    });
+    size_t matcher_bytes = 0;
+    double matcher_seconds = best_of(repeat, [&]() {
+        matcher_bytes = 0;
+        for (size_t pos : starts)
+            matcher_bytes += matcher.scan(corpus.data() + pos, corpus.size() - pos).walked;
+    });
+    if (json)
+        printf("%s{\"dfa\": \"%s\", \"matches\": %zu, \"bytes_walked\": %zu, \"table_seconds\": %.9f, "
+               "\"generated_seconds\": %.9f, \"speedup\": %.3f, \"matcher_seconds\": %.9f, \"matcher_speedup\": %.3f}",
+               first ? "" : ", ", name, starts.size(), table_bytes, table_seconds, generated_seconds,
+               table_seconds / generated_seconds, matcher_seconds, table_seconds / matcher_seconds);
+    else
+    {
+        printf("%s DFA: %zu matches, %zu bytes walked\n", name, starts.size(), table_bytes);
+        printf("  %-10s %9.3f ms %7.3f ns/byte\n", "table", table_seconds * 1e3, table_seconds * 1e9 / table_bytes);
+        printf("  %-10s %9.3f ms %7.3f ns/byte\n", "generated", generated_seconds * 1e3,
+               generated_seconds * 1e9 / generated_bytes);
+        printf("  %-10s %9.3f ms %7.3f ns/byte\n", "matcher", matcher_seconds * 1e3,
+               matcher_seconds * 1e9 / matcher_bytes);
+        printf("  speedup    %9.2fx generated, %.2fx matcher\n", table_seconds / generated_seconds,
+               table_seconds / matcher_seconds);
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t size = 8 << 20;
+    int repeat = 5;
+    uint64_t seed = 1;
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--size") == 0 && has_value)
+            size = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--size BYTES] [--repeat N] [--seed N] [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::string numeric = CorpusGenerator(MIX_NUMERIC, seed).generate(size);
+    std::string balanced = CorpusGenerator(MIX_BALANCED, seed).generate(size);
+    std::vector<size_t> constant_starts =
+        token_starts(numeric, [](char ch) { return (ch >= '0' && ch <= '9') || ch == '.'; });
+    std::vector<size_t> identifier_starts = token_starts(balanced, [](char ch) {
+        return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_';
+    });
+
+    DFA constant_dfa(CONSTANT_DFA);
+    DFA identifier_dfa(IDENTIFIER_DFA);
+    if (json)
+        printf("{\"results\": [");
+    auto constant_scan = [](const char *data, size_t length) { return scan_constant(data, length); };
+    auto identifier_scan = [](const char *data, size_t length) { return scan_identifier(data, length); };
+    bool ok = compare("constant", constant_dfa, constant_scan, constant_matcher, numeric, constant_starts, repeat, json,
+                      true) &&
+              compare("identifier", identifier_dfa, identifier_scan, identifier_matcher, balanced, identifier_starts,
+                      repeat, json, false);
+    if (json)
+        printf("]}\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+// 用 DFA 在文本中做无锚点查找，类似 grep -o：逐个输出互不重叠的最左最长匹配
+// 默认使用 constant DFA（从日志中提取数值常量），--identifier 换成标识符 DFA，
+// --dfa FILE 读取 dfa_test 导出的 DFA；不给文件时读标准输入
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "DFA.h"
+#include "LineIndex.h"
+#include "keys_patterns.h"
+
+static bool read_all(std::istream &in, std::string &buffer)
+{
+    std::ostringstream content;
+    content << in.rdbuf();
+    buffer = content.str();
+    return !in.bad();
+}
+
+/* 输出一个输入中的全部匹配；show_name 时每行前加文件名，line_numbers 时加 行:列 */
+static size_t grep_buffer(dfa_searcher &searcher, const std::string &name, const std::string &buffer, bool show_name,
+                          bool line_numbers)
+{
+    std::vector<dfa_match_t> matches = searcher.find_all(buffer);
+    LineIndex lines;
+    if (line_numbers)
+        lines.build(buffer.data(), buffer.size());
+    for (const auto &match : matches)
+    {
+        if (show_name)
+            printf("%s:", name.c_str());
+        if (line_numbers)
+        {
+            source_position_t where = lines.locate(match.begin);
+            printf("%zu:%zu:", where.line, where.column);
+        }
+        fwrite(buffer.data() + match.begin, 1, match.end - match.begin, stdout);
+        putchar('\n');
+    }
+    return matches.size();
+}
+
+int main(int argc, char *argv[])
+{
+    const std::string *dfa_text = &CONSTANT_DFA;
+    std::string loaded;
+    bool line_numbers = false;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--identifier") == 0)
+            dfa_text = &IDENTIFIER_DFA;
+        else if (strcmp(argv[i], "--dfa") == 0 && i + 1 < argc)
+        {
+            std::ifstream file(argv[++i]);
+            if (!file || !read_all(file, loaded))
+            {
+                perror(argv[i]);
+                return 2;
+            }
+            dfa_text = &loaded;
+        }
+        else if (strcmp(argv[i], "-n") == 0)
+            line_numbers = true;
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+            fprintf(stderr, "usage: %s [--identifier | --dfa FILE] [-n] [FILE...]\n", argv[0]);
+            return 2;
+        }
+        else
+            files.push_back(argv[i]);
+    }
+
+    DFA dfa(*dfa_text);
+    dfa_searcher searcher(dfa); // 各个文件共用已经建好的反向状态
+    size_t found = 0;
+    std::string buffer;
+    if (files.empty())
+    {
+        read_all(std::cin, buffer);
+        found += grep_buffer(searcher, "-", buffer, false, line_numbers);
+    }
+    for (const auto &path : files)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file || !read_all(file, buffer))
+        {
+            perror(path.c_str());
+            continue;
+        }
+        found += grep_buffer(searcher, path, buffer, files.size() > 1, line_numbers);
+    }
+    return found ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+// DFA 状态布局基准测试
+// 在同一份数字语料上比较 constant DFA 在不同状态编号下的 longest_match 吞吐量：
+//   bfs      构造时默认使用的广度优先编号
+//   profile  按训练语料上各状态的转移次数从高到低编号（训练语料与测试语料使用不同的种子）
+//   reverse  广度优先编号倒过来（起始状态仍在最前），热状态被分散到表的两端
+//   shuffle  随机编号，作为局部性最差的参照
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "DFA.h"
+#include "keys_patterns.h"
+#include "CorpusGenerator.h"
+
+/* 语料中以数字或小数点开头的单元的起始位置，即词法分析器调用 constant DFA 的位置 */
+static std::vector<size_t> constant_starts(const std::string &corpus)
+{
+    std::vector<size_t> starts;
+    bool at_token_start = true;
+    for (size_t i = 0; i < corpus.size(); i++)
+    {
+        char ch = corpus[i];
+        bool blank = ch == ' ' || ch == '\n' || ch == '\t';
+        if (at_token_start && !blank && ((ch >= '0' && ch <= '9') || ch == '.'))
+            starts.push_back(i);
+        at_token_start = blank;
+    }
+    return starts;
+}
+
+static std::vector<std::string> constant_samples(const std::string &corpus)
+{
+    std::vector<std::string> samples;
+    for (size_t start : constant_starts(corpus))
+    {
+        size_t end = corpus.find_first_of(" \n\t", start);
+        samples.push_back(corpus.substr(start, end == std::string::npos ? std::string::npos : end - start));
+    }
+    return samples;
+}
+
+static double time_layout(DFA &dfa, const std::string &corpus, const std::vector<size_t> &starts, int repeat,
+                          size_t &walked)
+{
+    double best = 0;
+    for (int r = 0; r < repeat; r++)
+    {
+        size_t total = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t pos : starts)
+            total += dfa.longest_match(corpus, pos);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (r == 0 || elapsed < best)
+            best = elapsed;
+        walked = total;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t size = 8 << 20;
+    int repeat = 5;
+    uint64_t seed = 1;
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--size") == 0 && has_value)
+            size = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--size BYTES] [--repeat N] [--seed N] [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::string corpus = CorpusGenerator(MIX_NUMERIC, seed).generate(size);
+    std::string training = CorpusGenerator(MIX_NUMERIC, seed + 1).generate(size / 4);
+    std::vector<size_t> starts = constant_starts(corpus);
+
+    DFA dfa(CONSTANT_DFA);
+    std::vector<int> bfs = dfa.bfs_order(); // 构造后已是广度优先编号，这里是恒等排列
+    std::vector<int> profile = dfa.profile_order(constant_samples(training));
+    std::vector<int> reverse(bfs);
+    std::reverse(reverse.begin() + 1, reverse.end());
+    std::vector<int> shuffle(bfs);
+    uint64_t rng = seed * 0x9E3779B97F4A7C15ull + 1;
+    for (size_t i = shuffle.size() - 1; i > 1; i--)
+    {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        std::swap(shuffle[i], shuffle[1 + rng % i]);
+    }
+
+    // 每种布局都从广度优先编号出发重新排列，结束后再恢复
+    struct layout_t
+    {
+        const char *name;
+        const std::vector<int> *order;
+    };
+    const layout_t layouts[] = {{"bfs", &bfs}, {"profile", &profile}, {"reverse", &reverse}, {"shuffle", &shuffle}};
+    if (json)
+        printf("{\"states\": %zu, \"bytes\": %zu, \"matches\": %zu, \"layouts\": [", dfa.state_count(), corpus.size(),
+               starts.size());
+    else
+        printf("constant DFA: %zu states, %zu matches over %zu bytes\n", dfa.state_count(), starts.size(), corpus.size());
+    for (size_t k = 0; k < sizeof(layouts) / sizeof(layouts[0]); k++)
+    {
+        dfa.relayout(*layouts[k].order);
+        size_t walked = 0;
+        double seconds = time_layout(dfa, corpus, starts, repeat, walked);
+        if (json)
+            printf("%s{\"layout\": \"%s\", \"seconds\": %.9f, \"bytes_walked\": %zu, \"ns_per_byte\": %.3f}",
+                   k ? ", " : "", layouts[k].name, seconds, walked, seconds * 1e9 / walked);
+        else
+            printf("%-8s %9.3f ms %12zu bytes walked %7.3f ns/byte\n", layouts[k].name, seconds * 1e3, walked,
+                   seconds * 1e9 / walked);
+        // 恢复到广度优先编号：对当前编号求逆排列
+        std::vector<int> inverse(layouts[k].order->size());
+        for (size_t i = 0; i < inverse.size(); i++)
+            inverse[(*layouts[k].order)[i]] = static_cast<int>(i);
+        dfa.relayout(inverse);
+    }
+    if (json)
+        printf("]}\n");
+    return 0;
+}
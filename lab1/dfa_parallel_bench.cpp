@@ -0,0 +1,116 @@
+// 超长单个输入上的并行匹配基准测试
+// 生成一个很长的数值常量（十进制或十六进制数字串，可带后缀），比较 constant DFA 的 all_match
+// 与 all_match_parallel 在 1、2、4…… 直到 --threads 个线程下的耗时，并检查结果与串行一致；
+// --corrupt 在中间放一个非法字符，检查不匹配的情况
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "DFA.h"
+#include "keys_patterns.h"
+
+static std::string numeric_blob(size_t size, bool hex, uint64_t seed)
+{
+    std::string blob = hex ? "0x" : "1";
+    blob.reserve(size + 2);
+    const char *digits = hex ? "0123456789abcdefABCDEF" : "0123456789";
+    size_t digit_count = hex ? 22 : 10;
+    uint64_t rng = seed * 0x9E3779B97F4A7C15ull + 1;
+    while (blob.size() < size)
+    {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        blob.push_back(digits[rng % digit_count]);
+    }
+    blob += "UL";
+    return blob;
+}
+
+template <class Run>
+static double best_of(int repeat, Run &&run)
+{
+    double best = 0;
+    for (int r = 0; r < repeat; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (r == 0 || elapsed < best)
+            best = elapsed;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t size = 256 << 20;
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    int repeat = 3;
+    uint64_t seed = 1;
+    bool hex = false, corrupt = false, json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--size") == 0 && has_value)
+            size = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--threads") == 0 && has_value)
+            max_threads = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--hex") == 0)
+            hex = true;
+        else if (strcmp(argv[i], "--corrupt") == 0)
+            corrupt = true;
+        else if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--size BYTES] [--threads N] [--repeat N] [--seed N] [--hex] [--corrupt] [--json]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    std::string blob = numeric_blob(size, hex, seed);
+    if (corrupt)
+        blob[blob.size() / 2 + 1] = '#';
+    DFA dfa(CONSTANT_DFA);
+
+    bool serial = false;
+    double serial_seconds = best_of(repeat, [&]() { serial = dfa.all_match(blob); });
+    if (json)
+        printf("{\"bytes\": %zu, \"matched\": %s, \"serial_seconds\": %.9f, \"parallel\": [", blob.size(),
+               serial ? "true" : "false", serial_seconds);
+    else
+        printf("constant DFA on a %zu-byte %s literal (%s)\nserial       %9.3f ms\n", blob.size(),
+               hex ? "hex" : "decimal", serial ? "matched" : "not matched", serial_seconds * 1e3);
+    std::vector<size_t> thread_counts;
+    for (size_t threads = 1; threads < max_threads; threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads); // 最后一轮正好用满 --threads
+    for (size_t threads : thread_counts)
+    {
+        bool parallel = false;
+        double seconds = best_of(repeat, [&]() { parallel = dfa.all_match_parallel(blob, threads); });
+        if (parallel != serial)
+        {
+            fprintf(stderr, "all_match_parallel with %zu threads disagrees with all_match\n", threads);
+            return 1;
+        }
+        if (json)
+            printf("%s{\"threads\": %zu, \"seconds\": %.9f, \"speedup\": %.3f}", threads > 1 ? ", " : "", threads,
+                   seconds, serial_seconds / seconds);
+        else
+            printf("%2zu threads   %9.3f ms  %6.2fx\n", threads, seconds * 1e3, serial_seconds / seconds);
+    }
+    if (json)
+        printf("]}\n");
+    return 0;
+}
@@ -1,10 +1,8 @@
 #include <bits/stdc++.h>
-#include <windows.h>
-#include <psapi.h>
 #include "DFA.h"
 #include "keys_patterns.h"
 
-int main()
+int main(int argc, char *argv[])
 {
     /*
      * 该解析器所采用的正则表达式（正则定义）部分语法如下
@@ -24,6 +22,23 @@ int main()
     auto constant_dfa = DFA(NFA(RE(CONSTANT_PATTERN)));
     auto identifier_dfa = DFA(NFA(RE(IDENTIFIER_PATTERN)));
 
+    // dfa_test --emit-cpp <输出头文件>：把两个 DFA 生成为可直接执行的 C++ 扫描函数，以及供 dfa_matcher 使用的
+    // 静态转移表；constant 另有一份保留原状态编号、用标志数组表示终态的表（构建时由 CMake 调用）
+    if (argc == 3 && std::string(argv[1]) == "--emit-cpp")
+    {
+        std::ofstream f_cpp(argv[2], std::ios::binary);
+        f_cpp << "// 由 dfa_test --emit-cpp 根据 keys_patterns.h 中的正则定义生成，请勿手动修改\n"
+              << "#ifndef DFA_SCANNERS_H\n#define DFA_SCANNERS_H\n\n#include <cstddef>\n#include <cstdint>\n"
+              << "#include \"DFAMatcher.h\"\n\n"
+              << constant_dfa.export2cpp("scan_constant") << "\n"
+              << identifier_dfa.export2cpp("scan_identifier") << "\n"
+              << constant_dfa.export2table("constant_matcher") << "\n"
+              << identifier_dfa.export2table("identifier_matcher") << "\n"
+              << constant_dfa.export2table("constant_matcher_layout", true) << "\n"
+              << "#endif\n";
+        return f_cpp ? 0 : 1;
+    }
+
     std::ofstream f_const("dfa_constant.txt");
     f_const << constant_dfa.export2str();
     f_const.close();
@@ -0,0 +1,58 @@
+// 构建时工具：把 c_keys.txt 转换成按字节序排好序的静态数组，供 KeyTable 直接嵌入程序
+// 用法：gen_keys_table <c_keys.txt> <输出头文件>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+static std::string escape(const std::string &str)
+{
+    std::string res;
+    for (char c : str)
+    {
+        if (c == '\\' || c == '"')
+            res.push_back('\\');
+        res.push_back(c);
+    }
+    return res;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <c_keys.txt> <output header>" << std::endl;
+        return 1;
+    }
+    std::ifstream in(argv[1]);
+    if (!in)
+    {
+        std::cerr << "cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+    // 与运行时加载词表的规则保持一致：std::map 按 std::string 的字节序排序，重复项以最后一次为准
+    std::map<std::string, int> keys_map;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream iss(line);
+        int key;
+        std::string value;
+        if (iss >> value >> key)
+            keys_map[value] = key;
+    }
+
+    std::ostringstream out;
+    out << "// 由 gen_keys_table 根据 c_keys.txt 生成，请勿手动修改\n";
+    out << "#ifndef C_KEYS_TABLE_H\n#define C_KEYS_TABLE_H\n\n";
+    out << "static const key_entry_t EMBEDDED_KEYS[] = {\n";
+    for (const auto &ele : keys_map)
+        out << "    {\"" << escape(ele.first) << "\", " << ele.first.length() << ", " << ele.second << "},\n";
+    out << "};\n\n#endif\n";
+
+    std::ofstream file(argv[2], std::ios::binary);
+    file << out.str();
+    return file ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+// 关键字多模式匹配基准测试
+// 在合成语料中找出关键字表里全部关键字、运算符的所有出现：比较逐个位置按每种长度查 KeyTable 的朴素做法
+// 与 KeyMatcher（Aho–Corasick，一遍扫描）的吞吐量，并检查两者找到的 (位置, 种别码) 完全一致
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "CorpusGenerator.h"
+#include "KeyMatcher.h"
+#include "KeyTable.h"
+
+/* 朴素做法：每个位置上尝试 1 到最长关键字的每种长度 */
+static std::vector<key_occurrence_t> naive_find_all(const KeyTable &keys, const std::string &text)
+{
+    std::vector<key_occurrence_t> occurrences;
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        size_t longest = std::min(keys.longest(), text.size() - i);
+        for (size_t length = 1; length <= longest; length++)
+        {
+            int code = keys.find(text.data() + i, length);
+            bool placeholder = code == keys.identifier() || code == keys.constant() || code == keys.comment();
+            if (code != -1 && !placeholder)
+                occurrences.push_back({i, code});
+        }
+    }
+    return occurrences;
+}
+
+static bool occurrence_less(const key_occurrence_t &a, const key_occurrence_t &b)
+{
+    return a.position != b.position ? a.position < b.position : a.code < b.code;
+}
+
+template <class Run>
+static double best_of(int repeat, Run &&run)
+{
+    double best = 0;
+    for (int r = 0; r < repeat; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (r == 0 || elapsed < best)
+            best = elapsed;
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t size = 8 << 20;
+    int repeat = 5;
+    uint64_t seed = 1;
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--size") == 0 && has_value)
+            size = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--json") == 0)
+            json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--size BYTES] [--repeat N] [--seed N] [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::string corpus = CorpusGenerator(MIX_BALANCED, seed).generate(size);
+    auto keys = KeyTable::builtin();
+    KeyMatcher matcher(*keys);
+
+    std::vector<key_occurrence_t> naive, automaton;
+    double naive_seconds = best_of(repeat, [&]() { naive = naive_find_all(*keys, corpus); });
+    double automaton_seconds = best_of(repeat, [&]() { automaton = matcher.find_all(corpus); });
+    std::sort(naive.begin(), naive.end(), occurrence_less);
+    std::vector<key_occurrence_t> sorted = automaton;
+    std::sort(sorted.begin(), sorted.end(), occurrence_less);
+    bool same = naive.size() == sorted.size() &&
+                std::equal(naive.begin(), naive.end(), sorted.begin(), [](const key_occurrence_t &a, const key_occurrence_t &b) {
+                    return a.position == b.position && a.code == b.code;
+                });
+    if (!same)
+    {
+        fprintf(stderr, "KeyMatcher disagrees with the per-position lookup (%zu vs %zu occurrences)\n",
+                sorted.size(), naive.size());
+        return 1;
+    }
+
+    if (json)
+        printf("{\"bytes\": %zu, \"occurrences\": %zu, \"states\": %zu, \"table_bytes\": %zu, \"naive_seconds\": %.9f, "
+               "\"automaton_seconds\": %.9f, \"speedup\": %.3f}\n",
+               corpus.size(), automaton.size(), matcher.state_count(), matcher.table_bytes(), naive_seconds,
+               automaton_seconds, naive_seconds / automaton_seconds);
+    else
+    {
+        printf("%zu bytes, %zu occurrences; automaton: %zu states, %zu-byte table\n", corpus.size(), automaton.size(),
+               matcher.state_count(), matcher.table_bytes());
+        printf("%-10s %9.3f ms %8.2f MB/s\n", "per-pos", naive_seconds * 1e3, corpus.size() / naive_seconds / 1e6);
+        printf("%-10s %9.3f ms %8.2f MB/s\n", "automaton", automaton_seconds * 1e3,
+               corpus.size() / automaton_seconds / 1e6);
+        printf("speedup    %9.2fx\n", naive_seconds / automaton_seconds);
+    }
+    return 0;
+}
@@ -43,597 +43,34 @@ digit       -> 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9
 
 std::string CONSTANT_DFA =
 R"delimiter(
-589
-0011111101111011111111111011011111111111110011010011111111101100111111101110110000000001011111111110111111111110111111111001111111011010101100100110111111111111111111110111111010010101100100101111111111011111111111100111111010010110110010010110001111010101111111111011010010110000000000011101011011010101011000111010110111010011111111111111111111110110001110101101111010000000000000000000000110110001110101101111101001101100011101011011101001101100011101011110100101100011010111100101100100111001011000100101100001011000101100010100001010000100000100000100000000000000000000000000000000000
-0 0 1 46 8 48 12 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 6 57 7 
-1 0 13 46 8 48 12 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 6 57 7 
-2 0 3 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-3 0 4 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-4 0 11 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-5 0 6 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-6 0 7 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-7 0 27 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-8 0 28 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 
-9 0 5 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-10 0 15 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-11 0 9 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-12 0 37 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 66 46 69 25 76 14 85 20 88 48 98 46 101 25 108 24 117 20 120 48 
-13 0 49 46 8 48 12 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 6 57 7 
-14 0 50 76 51 85 52 117 52 
-15 0 16 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-16 0 17 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-17 0 26 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-18 0 19 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-19 0 21 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-20 0 53 76 54 108 55 
-21 0 56 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-22 0 57 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-23 0 18 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-24 0 60 85 52 108 61 117 52 
-25 0 62 43 63 45 71 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-26 0 23 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-27 0 74 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-28 0 75 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 
-29 0 30 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-30 0 31 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-31 0 36 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-32 0 33 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-33 0 22 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-34 0 32 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-35 0 29 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-36 0 34 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-37 0 76 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 66 46 69 25 76 14 85 20 88 48 98 46 101 25 108 24 117 20 120 48 
-38 0 39 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-39 0 40 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-40 0 47 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-41 0 77 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-42 0 43 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-43 0 85 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-44 0 41 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-45 0 38 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-46 0 86 48 87 49 87 
-47 0 44 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-48 0 88 46 99 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 97 106 98 102 99 98 100 108 101 109 102 89 
-49 0 111 46 8 48 112 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 6 57 7 
-50 0 51 76 51 85 52 117 52 
-51 0 113 85 52 117 52 
-52 0 114 
-53 0 115 76 54 108 55 
-54 0 116 76 58 
-55 0 117 108 118 
-56 0 119 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-57 0 120 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-58 0 52 
-59 0 121 43 122 45 130 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-60 0 51 85 52 108 61 117 52 
-61 0 51 85 52 117 52 
-62 0 133 43 63 45 71 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-63 0 71 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-64 0 65 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-65 0 66 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-66 0 73 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-67 0 68 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-68 0 69 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-69 0 134 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-70 0 67 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-71 0 135 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-72 0 64 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-73 0 70 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-74 0 136 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-75 0 137 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 
-76 0 138 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 66 46 69 25 76 14 85 20 88 48 98 46 101 25 108 24 117 20 120 48 
-77 0 139 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-78 0 79 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-79 0 80 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-80 0 84 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-81 0 42 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-82 0 81 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-83 0 78 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-84 0 82 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-85 0 140 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-86 0 141 48 87 49 87 
-87 0 142 48 87 49 87 76 14 85 20 108 24 117 20 
-88 0 143 46 99 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 97 106 98 102 99 98 100 108 101 109 102 89 
-89 0 90 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-90 0 105 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-91 0 92 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-92 0 93 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-93 0 104 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-94 0 95 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-95 0 96 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-96 0 106 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-97 0 146 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-98 0 108 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-99 0 147 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 97 163 98 159 99 156 100 165 101 166 102 148 
-100 0 94 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-101 0 91 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-102 0 98 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-103 0 97 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-104 0 100 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-105 0 110 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-106 0 102 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-107 0 103 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-108 0 109 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-109 0 89 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-110 0 107 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-111 0 168 46 8 48 112 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 6 57 7 
-112 0 169 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 66 46 69 25 76 14 85 20 98 46 101 25 108 24 117 20 
-113 0 170 85 52 117 52 
-114 0 171 
-115 0 172 76 54 108 55 
-116 0 58 76 58 
-117 0 58 108 118 
-118 0 58 
-119 0 173 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-120 0 174 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-121 0 175 43 122 45 130 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-122 0 130 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-123 0 124 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-124 0 125 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-125 0 132 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-126 0 127 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-127 0 128 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-128 0 176 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-129 0 126 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-130 0 177 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-131 0 123 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-132 0 129 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-133 0 178 43 63 45 71 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-134 0 179 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-135 0 180 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-136 0 181 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-137 0 182 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 
-138 0 183 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-139 0 184 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-140 0 185 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-141 0 186 48 87 49 87 
-142 0 187 48 87 49 87 76 14 85 20 108 24 117 20 
-143 0 188 46 99 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 97 106 98 102 99 98 100 108 101 109 102 89 
-144 0 189 43 191 45 202 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-145 0 213 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-146 0 214 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-147 0 215 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 97 163 98 159 99 156 100 165 101 166 102 148 
-148 0 149 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-149 0 162 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-150 0 151 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-151 0 152 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-152 0 161 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-153 0 154 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-154 0 155 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-155 0 163 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-156 0 165 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-157 0 153 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-158 0 150 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-159 0 156 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-160 0 145 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-161 0 157 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-162 0 167 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-163 0 159 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-164 0 160 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-165 0 166 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-166 0 148 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-167 0 164 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-168 0 216 46 8 48 83 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 6 57 7 
-169 0 217 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 66 46 69 25 76 14 85 20 98 46 101 25 108 24 117 20 
-170 0 218 85 52 117 52 
-171 0 219 
-172 0 220 76 54 108 55 
-173 0 221 46 22 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 21 69 25 76 14 85 20 101 25 108 24 117 20 
-174 0 222 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 57 22 69 59 70 58 76 52 101 59 102 58 108 52 
-175 0 223 43 122 45 130 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-176 0 224 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-177 0 225 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-178 0 226 43 63 45 71 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-179 0 227 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-180 0 228 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-181 0 229 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 57 230 69 25 76 14 85 20 101 25 108 24 117 20 
-182 0 231 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 
-183 0 232 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 81 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-184 0 233 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-185 0 234 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-186 0 235 48 87 49 87 
-187 0 236 48 87 49 87 76 14 85 20 108 24 117 20 
-188 0 237 46 99 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 97 106 98 102 99 98 100 108 101 109 102 89 
-189 0 238 43 191 45 202 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-190 0 192 70 58 76 52 102 58 108 52 
-191 0 202 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-192 0 207 70 58 76 52 102 58 108 52 
-193 0 194 70 58 76 52 102 58 108 52 
-194 0 195 70 58 76 52 102 58 108 52 
-195 0 206 70 58 76 52 102 58 108 52 
-196 0 197 70 58 76 52 102 58 108 52 
-197 0 198 70 58 76 52 102 58 108 52 
-198 0 208 70 58 76 52 102 58 108 52 
-199 0 239 70 58 76 52 102 58 108 52 
-200 0 210 70 58 76 52 102 58 108 52 
-201 0 196 70 58 76 52 102 58 108 52 
-202 0 240 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-203 0 193 70 58 76 52 102 58 108 52 
-204 0 200 70 58 76 52 102 58 108 52 
-205 0 199 70 58 76 52 102 58 108 52 
-206 0 201 70 58 76 52 102 58 108 52 
-207 0 212 70 58 76 52 102 58 108 52 
-208 0 204 70 58 76 52 102 58 108 52 
-209 0 205 70 58 76 52 102 58 108 52 
-210 0 211 70 58 76 52 102 58 108 52 
-211 0 190 70 58 76 52 102 58 108 52 
-212 0 209 70 58 76 52 102 58 108 52 
-213 0 241 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-214 0 242 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-215 0 243 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 97 163 98 159 99 156 100 165 101 166 102 148 
-216 0 244 46 8 48 83 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 6 57 245 
-217 0 138 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 41 56 42 57 43 66 46 69 25 76 14 85 20 98 46 101 25 108 24 117 20 
-218 0 171 85 52 117 52 
-219 
-220 0 246 76 247 108 55 
-221 0 248 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 19 69 25 76 14 85 20 101 25 108 24 117 20 
-222 0 249 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 56 33 69 59 70 58 76 52 101 59 102 58 108 52 
-223 0 250 43 122 45 130 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-224 0 251 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-225 0 252 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-226 0 63 43 63 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-227 0 253 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 70 58 76 52 102 58 108 52 
-228 0 254 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-229 0 255 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 56 256 76 14 85 20 108 24 117 20 
-230 0 257 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-231 0 265 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 
-232 0 266 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 82 55 81 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-233 0 267 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 44 55 81 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-234 0 268 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 69 25 101 25 
-235 48 87 49 87 
-236 0 269 48 87 49 87 76 14 85 20 108 24 117 20 
-237 0 270 46 99 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 97 106 98 102 99 98 100 108 101 109 102 89 
-238 0 271 43 191 45 202 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-239 0 272 70 58 76 52 102 58 108 52 
-240 0 273 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-241 0 274 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-242 0 275 46 145 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 97 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-243 0 276 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 97 163 98 159 99 156 100 165 101 166 102 148 
-244 0 277 48 83 49 10 50 2 51 3 52 4 53 11 54 9 55 5 56 278 
-245 0 279 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-246 0 219 76 247 108 247 
-247 0 118 
-248 0 287 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 18 76 14 85 20 108 24 117 20 
-249 0 288 48 35 49 35 50 29 51 30 52 31 53 36 54 34 55 32 69 59 70 58 76 52 101 59 102 58 108 52 
-250 0 122 43 122 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-251 0 289 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 70 58 76 52 102 58 108 52 
-252 0 290 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-253 0 291 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 70 58 76 52 102 58 108 52 
-254 0 292 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 57 69 
-255 0 293 48 10 49 10 50 15 51 16 52 17 53 26 54 23 55 261 76 14 85 20 108 24 117 20 
-256 0 230 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-257 0 294 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-258 0 259 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-259 0 260 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-260 0 264 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-261 0 256 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-262 0 261 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-263 0 258 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-264 0 262 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-265 0 295 48 35 49 35 50 29 51 30 52 31 53 36 54 34 
-266 0 296 46 22 48 45 49 45 50 38 51 39 52 40 53 84 54 82 55 81 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-267 0 297 46 22 48 45 49 45 50 38 51 39 52 40 53 47 54 82 55 81 56 42 57 43 69 25 76 14 85 20 101 25 108 24 117 20 
-268 0 298 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 
-269 0 299 76 14 85 20 108 24 117 20 
-270 0 300 46 99 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 301 97 106 98 102 99 98 100 108 101 109 102 89 
-271 0 302 43 191 45 202 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-272 0 303 70 58 76 52 102 58 108 52 
-273 0 304 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-274 0 305 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 145 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-275 0 306 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 103 70 58 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-276 0 307 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 97 163 98 159 99 156 100 165 101 166 102 148 
-277 0 308 48 83 49 10 50 2 51 3 52 4 53 11 54 9 55 283 
-278 0 245 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-279 0 309 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-280 0 281 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-281 0 282 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-282 0 286 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-283 0 278 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-284 0 283 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-285 0 280 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-286 0 284 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-287 0 310 48 10 49 10 50 15 51 16 52 17 53 26 54 23 76 14 85 20 108 24 117 20 
-288 0 311 48 35 49 35 50 29 51 30 52 31 53 36 54 34 69 59 70 58 76 52 101 59 102 58 108 52 
-289 0 312 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 70 58 76 52 102 58 108 52 
-290 0 313 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 57 128 
-291 0 314 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 70 58 76 52 102 58 108 52 
-292 0 315 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 56 68 
-293 0 316 48 10 49 10 50 15 51 16 52 17 53 26 54 262 76 14 85 20 108 24 117 20 
-294 0 317 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-295 0 318 48 35 49 35 50 29 51 30 52 31 53 36 
-296 0 319 46 22 48 45 49 45 50 38 51 39 52 80 53 84 54 82 55 81 56 42 57 43 69 25 76 320 85 20 101 25 108 24 117 20 
-297 0 321 48 45 49 45 50 38 51 39 52 40 53 84 54 82 55 81 56 42 69 25 76 14 85 20 101 25 108 24 117 20 
-298 0 322 48 83 49 83 50 78 51 79 52 80 53 84 54 82 
-299 0 323 76 14 85 20 108 24 117 20 
-300 0 324 46 99 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 69 326 70 325 97 106 98 102 99 98 100 108 101 109 102 89 
-301 0 327 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-302 0 191 43 191 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-303 0 347 70 58 76 52 102 58 108 52 
-304 0 348 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 70 199 97 208 98 204 99 200 100 210 101 211 102 190 
-305 0 349 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 69 160 70 58 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-306 0 350 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 107 70 58 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-307 0 351 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 97 163 98 159 99 156 100 165 101 166 102 148 
-308 0 352 48 83 49 10 50 2 51 3 52 4 53 11 54 284 
-309 0 353 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-310 0 354 48 10 49 10 50 15 51 16 52 17 53 26 76 14 85 20 108 24 117 20 
-311 0 355 48 35 49 35 50 29 51 30 52 31 53 36 70 58 76 52 102 58 108 52 
-312 0 356 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 70 58 76 52 102 58 108 52 
-313 0 357 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 56 127 
-314 0 358 48 72 49 72 50 64 51 65 52 66 53 73 54 70 70 58 76 52 102 58 108 52 
-315 0 359 48 72 49 72 50 64 51 65 52 66 53 73 54 70 55 67 
-316 0 360 48 10 49 10 50 15 51 16 52 17 53 264 76 14 85 20 108 24 117 20 
-317 0 361 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 57 230 76 14 85 20 108 24 117 20 
-318 0 362 48 35 49 35 50 29 51 30 52 31 
-319 0 363 46 22 48 45 49 45 50 38 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 76 320 85 247 101 25 108 364 117 247 
-320 0 365 76 118 85 52 117 52 
-321 0 366 48 45 49 45 50 38 51 39 52 80 53 84 54 82 55 81 76 14 85 20 108 24 117 20 
-322 0 367 48 83 49 83 50 78 51 79 52 80 53 84 
-323 0 368 76 14 85 20 108 24 117 20 
-324 0 369 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 68 343 69 370 97 106 98 102 99 98 100 108 101 109 102 89 
-325 0 371 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-326 0 301 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-327 0 391 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-328 0 329 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-329 0 341 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-330 0 331 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-331 0 332 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-332 0 340 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-333 0 334 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-334 0 335 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-335 0 342 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-336 0 344 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-337 0 333 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-338 0 330 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-339 0 336 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-340 0 337 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-341 0 346 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-342 0 339 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-343 0 326 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-344 0 345 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-345 0 328 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-346 0 343 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-347 0 392 70 58 76 52 102 58 108 52 
-348 0 393 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 69 205 97 208 98 204 99 200 100 210 101 211 102 190 
-349 0 394 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 68 164 70 58 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-350 0 395 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 110 70 58 76 14 80 144 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 112 144 117 20 
-351 0 396 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 97 163 98 159 99 156 100 165 101 166 102 148 
-352 0 397 48 83 49 10 50 2 51 3 52 4 53 286 
-353 0 398 46 22 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 57 245 
-354 0 399 48 10 49 10 50 15 51 16 52 17 76 14 85 20 108 24 117 20 
-355 0 400 48 35 49 35 50 29 51 30 52 31 70 58 76 52 102 58 108 52 
-356 0 401 48 131 49 131 50 123 51 124 52 125 53 132 54 129 70 58 76 52 102 58 108 52 
-357 0 402 48 131 49 131 50 123 51 124 52 125 53 132 54 129 55 126 
-358 0 403 48 72 49 72 50 64 51 65 52 66 53 73 70 58 76 52 102 58 108 52 
-359 0 404 48 72 49 72 50 64 51 65 52 66 53 73 54 70 
-360 0 405 48 10 49 10 50 15 51 16 52 260 76 14 85 20 108 24 117 20 
-361 0 406 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 56 256 76 14 85 20 108 24 117 20 
-362 0 407 48 35 49 35 50 29 51 30 
-363 0 408 46 22 48 45 49 45 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 76 409 85 247 101 25 108 410 117 247 
-364 0 411 85 52 108 247 117 52 
-365 0 51 76 118 85 52 117 52 
-366 0 412 48 45 49 45 50 38 51 79 52 80 53 84 54 82 76 14 85 20 108 24 117 20 
-367 0 413 48 83 49 83 50 78 51 79 52 80 
-368 0 414 76 14 85 20 108 24 117 20 
-369 0 415 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 67 346 68 387 97 106 98 102 99 98 100 108 101 109 102 89 
-370 0 325 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-371 0 416 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-372 0 373 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-373 0 385 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-374 0 375 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-375 0 376 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-376 0 384 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-377 0 378 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-378 0 379 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-379 0 386 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-380 0 388 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-381 0 377 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-382 0 374 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-383 0 380 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-384 0 381 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-385 0 390 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-386 0 383 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-387 0 370 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-388 0 389 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-389 0 372 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-390 0 387 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-391 0 417 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-392 0 418 70 58 76 52 102 58 108 52 
-393 0 419 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 68 209 97 208 98 204 99 200 100 210 101 211 102 190 
-394 0 420 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 67 167 70 58 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-395 0 421 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 105 70 58 76 320 85 20 97 106 98 102 99 98 100 108 101 109 102 89 108 24 117 20 
-396 0 422 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 97 163 98 159 99 156 100 165 101 166 102 148 
-397 0 423 48 83 49 10 50 2 51 3 52 282 
-398 0 424 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 56 278 
-399 0 425 48 10 49 10 50 15 51 16 76 320 85 20 108 24 117 20 
-400 0 426 48 35 49 35 50 29 51 30 70 58 76 52 102 58 108 52 
-401 0 427 48 131 49 131 50 123 51 124 52 125 53 132 70 58 76 52 102 58 108 52 
-402 0 428 48 131 49 131 50 123 51 124 52 125 53 132 54 129 
-403 0 429 48 72 49 72 50 64 51 65 52 66 70 58 102 58 
-404 0 430 48 72 49 72 50 64 51 65 52 66 53 73 
-405 0 431 48 10 49 10 50 15 51 259 76 320 85 20 108 24 117 20 
-406 0 432 48 263 49 263 50 258 51 259 52 260 53 264 54 262 55 261 76 14 85 20 108 24 117 20 
-407 0 433 48 35 49 35 50 29 
-408 0 434 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 76 409 101 25 108 409 
-409 0 247 
-410 0 435 108 247 
-411 0 51 85 52 108 247 117 52 
-412 0 436 48 45 49 45 50 78 51 79 52 80 53 84 76 320 85 20 108 24 117 20 
-413 0 437 48 83 49 83 50 78 51 79 
-414 0 438 76 14 85 20 108 24 117 20 
-415 0 439 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 66 341 67 390 97 106 98 102 99 98 100 108 101 109 102 89 
-416 0 440 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-417 0 441 46 145 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 301 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-418 0 442 70 58 76 52 102 58 108 52 
-419 0 443 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 67 212 97 208 98 204 99 200 100 210 101 211 102 190 
-420 0 444 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 66 162 70 58 76 52 80 144 97 163 98 159 99 156 100 165 101 166 102 148 108 52 112 144 
-421 0 445 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 90 70 58 76 320 85 247 97 106 98 102 99 98 100 108 101 109 102 89 108 364 117 247 
-422 0 446 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 97 163 98 159 99 156 100 165 101 166 102 148 
-423 0 447 48 83 49 10 50 2 51 281 
-424 0 448 48 285 49 285 50 280 51 281 52 282 53 286 54 284 55 283 
-425 0 449 48 10 49 10 50 15 76 320 85 247 108 364 117 247 
-426 0 450 48 35 49 35 50 29 70 58 76 52 102 58 108 52 
-427 0 451 48 131 49 131 50 123 51 124 52 125 70 58 76 52 102 58 108 52 
-428 0 452 48 131 49 131 50 123 51 124 52 125 53 132 
-429 0 453 48 72 49 72 50 64 51 65 
-430 0 454 48 72 49 72 50 64 51 65 52 66 
-431 0 455 48 10 49 10 50 258 76 320 85 247 108 364 117 247 
-432 0 456 48 263 49 263 50 258 51 259 52 260 53 264 54 262 76 14 85 20 108 24 117 20 
-433 48 35 49 35 
-434 0 457 46 22 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 57 43 69 25 101 25 
-435 0 118 108 247 
-436 0 458 48 83 49 83 50 78 51 79 52 80 76 320 85 247 108 364 117 247 
-437 0 459 48 83 49 83 50 78 
-438 0 460 76 320 85 20 108 24 117 20 
-439 0 461 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 329 66 385 97 106 98 102 99 98 100 108 101 109 102 89 
-440 0 462 46 145 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 70 325 97 386 98 383 99 380 100 388 101 389 102 372 
-441 0 463 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 69 326 70 58 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-442 0 114 70 58 102 58 
-443 0 464 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 66 207 97 208 98 204 99 200 100 210 101 211 102 190 
-444 0 465 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 65 149 70 58 76 52 97 163 98 159 99 156 100 165 101 166 102 148 108 52 
-445 0 466 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 70 58 76 409 85 247 97 106 98 102 99 98 100 108 101 109 102 89 108 410 117 247 
-446 0 467 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 97 163 98 159 99 156 100 165 101 166 102 148 
-447 0 468 48 83 49 83 50 280 
-448 0 469 48 285 49 285 50 280 51 281 52 282 53 286 54 284 
-449 0 470 48 10 49 10 76 409 85 247 108 410 117 247 
-450 0 418 48 35 49 35 70 58 76 52 102 58 108 52 
-451 0 471 48 131 49 131 50 123 51 124 70 58 102 58 
-452 0 472 48 131 49 131 50 123 51 124 52 125 
-453 0 473 48 72 49 72 50 64 
-454 0 474 48 72 49 72 50 64 51 65 
-455 0 470 48 263 49 263 76 409 85 247 108 410 117 247 
-456 0 475 48 263 49 263 50 258 51 259 52 260 53 264 76 14 85 20 108 24 117 20 
-457 0 476 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 56 42 69 25 101 25 
-458 0 477 48 83 49 83 50 78 51 79 76 409 85 247 108 410 117 247 
-459 48 83 49 83 
-460 0 478 76 320 85 247 108 364 117 247 
-461 0 479 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 65 373 97 106 98 102 99 98 100 108 101 109 102 328 
-462 0 480 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 69 370 97 386 98 383 99 380 100 388 101 389 102 372 
-463 0 481 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 68 343 70 58 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-464 0 482 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 65 192 97 208 98 204 99 200 100 210 101 211 102 190 
-465 0 483 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 70 58 76 52 97 163 98 159 99 156 100 165 101 166 102 148 108 52 
-466 0 484 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 70 58 76 409 97 106 98 102 99 98 100 108 101 109 102 58 108 409 
-467 0 485 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 97 163 98 159 99 156 100 165 101 166 
-468 48 285 49 285 
-469 0 486 48 285 49 285 50 280 51 281 52 282 53 286 
-470 0 52 76 409 108 409 
-471 0 487 48 131 49 131 50 123 
-472 0 488 48 131 49 131 50 123 51 124 
-473 48 72 49 72 
-474 0 489 48 72 49 72 50 64 
-475 0 490 48 263 49 263 50 258 51 259 52 260 76 14 85 20 108 24 117 20 
-476 0 491 48 83 49 83 50 78 51 79 52 80 53 84 54 82 55 81 
-477 0 492 48 83 49 83 50 78 76 409 108 409 
-478 0 470 76 409 85 247 108 410 117 247 
-479 0 493 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 97 106 98 102 99 98 100 108 101 345 102 372 
-480 0 494 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 68 387 97 386 98 383 99 380 100 388 101 389 102 372 
-481 0 495 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 67 346 70 58 76 52 80 144 97 342 98 339 99 336 100 344 101 345 102 328 108 52 112 144 
-482 0 496 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 97 208 98 204 99 200 100 210 101 211 102 190 
-483 0 497 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 70 58 76 52 97 163 98 159 99 156 100 165 101 166 102 58 108 52 
-484 0 498 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 70 58 76 52 97 106 98 102 99 98 100 108 102 58 108 52 
-485 0 499 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 97 163 98 159 99 156 100 165 
-486 0 500 48 285 49 285 50 280 51 281 52 282 
-487 0 219 48 131 49 131 
-488 0 501 48 131 49 131 50 123 
-489 48 72 49 72 
-490 0 502 48 263 49 263 50 258 51 259 76 320 85 20 108 24 117 20 
-491 0 322 48 83 49 83 50 78 51 79 52 80 53 84 54 82 
-492 0 114 48 83 49 83 
-493 0 503 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 97 106 98 102 99 98 100 344 101 389 
-494 0 504 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 67 390 97 386 98 383 99 380 100 388 101 389 102 372 
-495 0 505 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 66 341 70 58 76 52 97 342 98 339 99 336 100 344 101 345 102 328 108 52 
-496 0 506 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 97 208 98 204 99 200 100 210 101 211 
-497 0 507 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 70 58 76 52 97 163 98 159 99 156 100 165 102 58 108 52 
-498 0 508 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 70 58 97 106 98 102 99 98 102 58 
-499 0 509 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 97 163 98 159 99 156 
-500 0 510 48 285 49 285 50 280 51 281 
-501 48 131 49 131 
-502 0 455 48 263 49 263 50 258 76 320 85 247 108 364 117 247 
-503 0 511 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 97 106 98 102 99 336 100 388 
-504 0 512 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 66 385 97 386 98 383 99 380 100 388 101 389 102 372 
-505 0 513 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 65 329 70 58 76 52 97 342 98 339 99 336 100 344 101 345 102 328 108 52 
-506 0 514 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 97 208 98 204 99 200 100 210 
-507 0 515 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 70 58 76 52 97 163 98 159 99 156 102 58 108 52 
-508 0 516 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 97 106 98 102 
-509 0 517 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 97 163 98 159 
-510 0 468 48 285 49 285 50 280 
-511 0 518 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 97 106 98 339 99 380 
-512 0 519 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 65 373 97 386 98 383 99 380 100 388 101 389 102 372 
-513 0 520 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 70 58 76 52 97 342 98 339 99 336 100 344 101 345 102 328 108 52 
-514 0 521 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 97 208 98 204 99 200 
-515 0 522 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 70 58 97 163 98 159 102 58 
-516 0 523 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 97 106 
-517 0 524 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 97 163 
-518 0 525 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 97 342 98 383 
-519 0 526 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 97 386 98 383 99 380 100 388 101 389 102 372 
-520 0 527 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 70 58 76 52 97 342 98 339 99 336 100 344 101 345 102 58 108 52 
-521 0 528 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 97 208 98 204 
-522 0 529 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 97 163 
-523 0 530 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 96 
-524 0 531 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 
-525 0 532 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 57 335 97 386 
-526 0 533 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 97 386 98 383 99 380 100 388 101 389 
-527 0 534 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 70 58 76 52 97 342 98 339 99 336 100 344 102 58 108 52 
-528 0 535 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 97 208 
-529 0 536 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 57 155 
-530 0 537 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 95 
-531 0 538 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 
-532 0 539 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 56 334 57 379 
-533 0 540 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 97 386 98 383 99 380 100 388 
-534 0 541 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 70 58 97 342 98 339 99 336 102 58 
-535 0 542 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 57 198 
-536 0 538 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 56 154 
-537 0 543 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 94 
-538 0 544 48 158 49 158 50 150 51 151 52 152 53 161 54 157 55 153 
-539 0 545 48 101 49 101 50 91 51 92 52 93 53 104 54 100 55 333 56 378 
-540 0 546 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 97 386 98 383 99 380 
-541 0 547 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 97 342 98 339 
-542 0 548 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 56 197 
-543 0 549 48 101 49 101 50 91 51 92 52 93 53 104 54 100 
-544 0 550 48 158 49 158 50 150 51 151 52 152 53 161 54 157 
-545 0 551 48 101 49 101 50 91 51 92 52 93 53 104 54 337 55 377 
-546 0 552 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 97 386 98 383 
-547 0 553 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 97 342 
-548 0 554 48 203 49 203 50 193 51 194 52 195 53 206 54 201 55 196 
-549 0 555 48 101 49 101 50 91 51 92 52 93 53 104 
-550 0 556 48 158 49 158 50 150 51 151 52 152 53 161 
-551 0 557 48 101 49 101 50 91 51 92 52 93 53 340 54 381 
-552 0 558 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 97 386 
-553 0 559 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 57 335 
-554 0 560 48 203 49 203 50 193 51 194 52 195 53 206 54 201 
-555 0 561 48 101 49 101 50 91 51 92 52 93 
-556 0 562 48 158 49 158 50 150 51 151 52 152 
-557 0 563 48 101 49 101 50 91 51 92 52 332 53 384 
-558 0 564 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 57 379 
-559 0 565 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 56 334 
-560 0 566 48 203 49 203 50 193 51 194 52 195 53 206 
-561 0 567 48 101 49 101 50 91 51 92 
-562 0 568 48 158 49 158 50 150 51 151 
-563 0 569 48 101 49 101 50 91 51 331 52 376 
-564 0 570 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 56 378 
-565 0 571 48 338 49 338 50 330 51 331 52 332 53 340 54 337 55 333 
-566 0 572 48 203 49 203 50 193 51 194 52 195 
-567 0 573 48 101 49 101 50 91 
-568 0 574 48 158 49 158 50 150 
-569 0 575 48 101 49 101 50 330 51 375 
-570 0 576 48 382 49 382 50 374 51 375 52 376 53 384 54 381 55 377 
-571 0 577 48 338 49 338 50 330 51 331 52 332 53 340 54 337 
-572 0 578 48 203 49 203 50 193 51 194 
-573 48 101 49 101 
-574 48 158 49 158 
-575 0 579 48 338 49 338 50 374 
-576 0 580 48 382 49 382 50 374 51 375 52 376 53 384 54 381 
-577 0 581 48 338 49 338 50 330 51 331 52 332 53 340 
-578 0 582 48 203 49 203 50 193 
-579 48 382 49 382 
-580 0 583 48 382 49 382 50 374 51 375 52 376 53 384 
-581 0 584 48 338 49 338 50 330 51 331 52 332 
-582 48 203 49 203 
-583 0 585 48 382 49 382 50 374 51 375 52 376 
-584 0 586 48 338 49 338 50 330 51 331 
-585 0 587 48 382 49 382 50 374 51 375 
-586 0 588 48 338 49 338 50 330 
-587 0 579 48 382 49 382 50 374 
-588 48 338 49 338 
+26
+00111100011011101111011001
+0 46 1 48 2 49 3 50 3 51 3 52 3 53 3 54 3 55 3 56 3 57 3 
+1 48 4 49 4 50 4 51 4 52 4 53 4 54 4 55 4 56 4 57 4 
+2 46 4 48 5 49 5 50 5 51 5 52 5 53 5 54 5 55 5 56 6 57 6 66 7 69 8 76 9 85 10 88 11 98 7 101 8 108 12 117 10 120 11 
+3 46 4 48 3 49 3 50 3 51 3 52 3 53 3 54 3 55 3 56 3 57 3 69 8 76 9 85 10 101 8 108 12 117 10 
+4 48 4 49 4 50 4 51 4 52 4 53 4 54 4 55 4 56 4 57 4 69 8 70 13 76 13 101 8 102 13 108 13 
+5 46 4 48 5 49 5 50 5 51 5 52 5 53 5 54 5 55 5 56 6 57 6 69 8 76 9 85 10 101 8 108 12 117 10 
+6 46 4 48 6 49 6 50 6 51 6 52 6 53 6 54 6 55 6 56 6 57 6 69 8 101 8 
+7 48 14 49 14 
+8 43 15 45 15 48 16 49 16 50 16 51 16 52 16 53 16 54 16 55 16 56 16 57 16 
+9 76 17 85 13 117 13 
+10 76 18 108 19 
+11 46 20 48 21 49 21 50 21 51 21 52 21 53 21 54 21 55 21 56 21 57 21 65 21 66 21 67 21 68 21 69 21 70 21 97 21 98 21 99 21 100 21 101 21 102 21 
+12 85 13 108 17 117 13 
+13 
+14 48 14 49 14 76 9 85 10 108 12 117 10 
+15 48 16 49 16 50 16 51 16 52 16 53 16 54 16 55 16 56 16 57 16 
+16 48 16 49 16 50 16 51 16 52 16 53 16 54 16 55 16 56 16 57 16 70 13 76 13 102 13 108 13 
+17 85 13 117 13 
+18 76 13 
+19 108 13 
+20 48 22 49 22 50 22 51 22 52 22 53 22 54 22 55 22 56 22 57 22 65 22 66 22 67 22 68 22 69 22 70 22 97 22 98 22 99 22 100 22 101 22 102 22 
+21 46 22 48 21 49 21 50 21 51 21 52 21 53 21 54 21 55 21 56 21 57 21 65 21 66 21 67 21 68 21 69 21 70 21 76 9 80 23 85 10 97 21 98 21 99 21 100 21 101 21 102 21 108 12 112 23 117 10 
+22 48 22 49 22 50 22 51 22 52 22 53 22 54 22 55 22 56 22 57 22 65 22 66 22 67 22 68 22 69 22 70 22 76 13 80 23 97 22 98 22 99 22 100 22 101 22 102 22 108 13 112 23 
+23 43 24 45 24 48 25 49 25 50 25 51 25 52 25 53 25 54 25 55 25 56 25 57 25 65 25 66 25 67 25 68 25 69 25 70 25 97 25 98 25 99 25 100 25 101 25 102 25 
+24 48 25 49 25 50 25 51 25 52 25 53 25 54 25 55 25 56 25 57 25 65 25 66 25 67 25 68 25 69 25 70 25 97 25 98 25 99 25 100 25 101 25 102 25 
+25 70 13 76 13 102 13 108 13 
 )delimiter";
 
 std::string IDENTIFIER_DFA =
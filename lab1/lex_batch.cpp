@@ -0,0 +1,273 @@
+// 批量词法分析
+// 把一组文件（或目录下的全部源文件）交给固定大小的线程池分析，每个工作线程持有一个可复用的分析器
+// 各文件的结果按输入顺序输出，格式与 lex_analysis 相同，每个文件前加一行 "==> 路径 <=="
+// --cache DIR 把每个文件的结果按内容缓存在磁盘上，之后的运行中内容没有变化的文件不再分析
+#include "LexAnalysis.h"
+#include "TokenCache.h"
+#include <deque>
+#include <dirent.h>
+#include <sys/stat.h>
+
+struct batch_result_t
+{
+    string text;
+    bool ok;
+};
+
+static bool is_directory(const string &path)
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+static bool has_extension(const string &path, const vector<string> &extensions)
+{
+    for (const auto &ext : extensions)
+    {
+        if (path.size() >= ext.size() && path.compare(path.size() - ext.size(), ext.size(), ext) == 0)
+            return true;
+    }
+    return false;
+}
+
+/* 递归列出目录下扩展名匹配的文件，同一目录内按名字排序，保证输出顺序稳定 */
+static void list_directory(const string &dir, const vector<string> &extensions, vector<string> &files)
+{
+    DIR *handle = opendir(dir.c_str());
+    if (!handle)
+    {
+        perror(dir.c_str());
+        return;
+    }
+    vector<string> names;
+    while (dirent *entry = readdir(handle))
+    {
+        string name = entry->d_name;
+        if (name != "." && name != "..")
+            names.push_back(name);
+    }
+    closedir(handle);
+    sort(names.begin(), names.end());
+    for (const auto &name : names)
+    {
+        string path = dir + "/" + name;
+        if (is_directory(path))
+            list_directory(path, extensions, files);
+        else if (has_extension(path, extensions))
+            files.push_back(path);
+    }
+}
+
+/* 所有文件共用的分析设置；头文件缓存在整个批次中共享，每个头文件只分析一次 */
+struct batch_config_t
+{
+    shared_ptr<const KeyTable> keys;
+    bool directives = false;
+    shared_ptr<header_cache_t> include_cache; // 为空时不展开 #include
+    vector<string> include_dirs;
+    shared_ptr<TokenCache> token_cache;       // 为空时不使用磁盘缓存
+};
+
+/*
+ * 磁盘缓存的配置哈希：词表的每一项、两个 DFA 导出的文本、分析选项
+ * 分析器本身的行为改变而这些都不变时，需要增加 LEX_CACHE_VERSION 使旧的缓存项失效
+*/
+static const int LEX_CACHE_VERSION = 3;
+
+static uint64_t lexer_config_hash(const KeyTable &keys, bool directives)
+{
+    string config = "lex_batch " + to_string(LEX_CACHE_VERSION) + (directives ? " directives\n" : "\n");
+    for (const auto &entry : keys)
+        config += string(entry.key, entry.length) + " " + to_string(entry.code) + "\n";
+    config += constant_dfa.export2str();
+    config += identifier_dfa.export2str();
+    return cache_hash(config.data(), config.size());
+}
+
+/* 在工作线程中执行：读文件、分析、格式化，缓冲区与分析器都是线程私有的，反复复用 */
+static batch_result_t lex_one(const string &path, const batch_config_t &config)
+{
+    thread_local string source;
+    thread_local unique_ptr<LexAnalyser> lexer;
+    thread_local TokenWriter writer(nullptr);
+    if (!lexer)
+    {
+        lexer.reset(new LexAnalyser(&source, config.keys));
+        lexer->enable_directives(config.directives);
+        if (config.include_cache)
+            lexer->follow_includes(config.include_cache, config.include_dirs);
+    }
+
+    batch_result_t result;
+    result.ok = read_source_file(path, source);
+    if (!result.ok)
+        return result;
+    writer.clear();
+    size_t index = 0;
+    auto write = [&index](int code, const char *text, size_t length) {
+        writer.write_token(code, text, length, ++index);
+    };
+    if (config.token_cache && config.token_cache->lookup(source, write))
+    {
+        result.text.assign(writer.data(), writer.size());
+        return result;
+    }
+    lexer->set_source_path(path);
+    lexer->reset(&source);
+    lexer->tokenize();
+    if (config.token_cache)
+    {
+        // 不展开 #include 时，输出的单元与 tokens() 一一对应
+        token_cache_entry_t entry(source);
+        for (const auto &lexed : lexer->tokens())
+        {
+            auto text = lexer->token_text(lexed);
+            entry.add(lexed.code, text.first, text.second, lexed.begin);
+        }
+        config.token_cache->store(source, entry);
+    }
+    lexer->write_tokens(writer);
+    result.text.assign(writer.data(), writer.size());
+    return result;
+}
+
+static vector<string> split_list(const string &str)
+{
+    vector<string> res;
+    istringstream iss(str);
+    string item;
+    while (getline(iss, item, ','))
+    {
+        if (!item.empty())
+            res.push_back(item);
+    }
+    return res;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-j N] [--keys FILE] [--ext .c,.h] [--list FILE]\n"
+            "          [--directives] [--follow-includes] [-I DIR]... [--cache DIR [--cache-size MB]] [PATH...]\n"
+            "  PATH 可以是文件或目录（递归查找扩展名匹配的文件）\n"
+            "  --list FILE 从文件中逐行读取待分析的路径\n"
+            "  --follow-includes 展开 #include \"...\"，头文件在整个批次中只分析一次\n"
+            "  --cache DIR 在 DIR 中按文件内容缓存结果，内容、词表、DFA 与选项都不变的文件直接取用\n"
+            "  --cache-size MB 运行结束后把缓存按最近使用时间淘汰到不超过 MB（默认 1024）\n",
+            argv0);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t threads = ThreadPool::default_size();
+    string keys_path;
+    batch_config_t config;
+    bool follow_includes = false;
+    vector<string> extensions = {".c", ".h"};
+    vector<string> inputs;
+    string cache_dir;
+    size_t cache_megabytes = 1024;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--threads") == 0) && has_value)
+            threads = static_cast<size_t>(max(1, atoi(argv[++i])));
+        else if (strcmp(argv[i], "--keys") == 0 && has_value)
+            keys_path = argv[++i];
+        else if (strcmp(argv[i], "--directives") == 0)
+            config.directives = true;
+        else if (strcmp(argv[i], "--follow-includes") == 0)
+            follow_includes = true;
+        else if (strcmp(argv[i], "-I") == 0 && has_value)
+            config.include_dirs.push_back(argv[++i]);
+        else if (strcmp(argv[i], "--cache") == 0 && has_value)
+            cache_dir = argv[++i];
+        else if (strcmp(argv[i], "--cache-size") == 0 && has_value)
+            cache_megabytes = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--ext") == 0 && has_value)
+            extensions = split_list(argv[++i]);
+        else if (strcmp(argv[i], "--list") == 0 && has_value)
+        {
+            ifstream list(argv[++i]);
+            string line;
+            while (getline(list, line))
+            {
+                if (!line.empty())
+                    inputs.push_back(line);
+            }
+        }
+        else if (argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        else
+            inputs.push_back(argv[i]);
+    }
+    if (inputs.empty())
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    vector<string> files;
+    for (const auto &input : inputs)
+    {
+        if (is_directory(input))
+            list_directory(input, extensions, files);
+        else
+            files.push_back(input);
+    }
+
+    config.keys = keys_path.empty() ? KeyTable::builtin() : KeyTable::load(keys_path);
+    if (!config.keys)
+    {
+        fprintf(stderr, "cannot load key table %s\n", keys_path.c_str());
+        return 1;
+    }
+    if (follow_includes)
+        config.include_cache = make_shared<header_cache_t>();
+    if (!cache_dir.empty() && follow_includes)
+        fprintf(stderr, "--cache is ignored with --follow-includes: the output also depends on the included files\n");
+    else if (!cache_dir.empty())
+        config.token_cache = make_shared<TokenCache>(cache_dir, lexer_config_hash(*config.keys, config.directives),
+                                                     cache_megabytes << 20);
+    bool all_ok = true;
+    {
+        ThreadPool pool(threads);
+        // 限制同时在途的文件数，已完成但还没轮到输出的结果不会无限堆积
+        const size_t max_in_flight = pool.size() * 4;
+        deque<future<batch_result_t>> pending;
+        size_t next_output = 0;
+        auto emit_front = [&]()
+        {
+            batch_result_t result = pending.front().get();
+            pending.pop_front();
+            const string &path = files[next_output++];
+            if (!result.ok)
+            {
+                fprintf(stderr, "cannot read %s\n", path.c_str());
+                all_ok = false;
+                return;
+            }
+            printf("==> %s <==\n", path.c_str());
+            fwrite(result.text.data(), 1, result.text.size(), stdout);
+        };
+        for (const auto &path : files)
+        {
+            if (pending.size() >= max_in_flight)
+                emit_front();
+            pending.push_back(pool.submit([&path, &config] { return lex_one(path, config); }));
+        }
+        while (!pending.empty())
+            emit_front();
+    }
+    fflush(stdout);
+    if (config.token_cache)
+    {
+        size_t evicted = config.token_cache->evict();
+        fprintf(stderr, "cache: %zu hits, %zu misses, %zu evicted\n", config.token_cache->hits(),
+                config.token_cache->misses(), evicted);
+    }
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+// 词法分析吞吐量基准测试
+// 用 CorpusGenerator 生成不同单元比例的合成语料，测量 tokens/s、bytes/s 以及各个 handle_* 的耗时占比
+#include "LexAnalysis.h"
+#include "CorpusGenerator.h"
+
+struct bench_result_t
+{
+    CorpusMix mix;
+    size_t bytes;
+    size_t tokens;
+    double seconds; // 多次重复中的最短耗时
+    lex_profile_t profile;
+};
+
+static double seconds_since(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static bench_result_t run_bench(CorpusMix mix, size_t size, uint64_t seed, int repeat)
+{
+    bench_result_t result;
+    result.mix = mix;
+    string corpus = CorpusGenerator(mix, seed).generate(size);
+    result.bytes = corpus.size();
+    result.seconds = 0;
+    for (int i = 0; i < repeat; i++)
+    {
+        LexAnalyser lexer(corpus);
+        auto start = chrono::steady_clock::now();
+        lexer.tokenize();
+        result.tokens = lexer.tokens().size();
+        double elapsed = seconds_since(start);
+        if (i == 0 || elapsed < result.seconds)
+            result.seconds = elapsed;
+    }
+    // 单独跑一遍带计时的分析，得到各 handler 的耗时拆分，不影响上面的吞吐量数字
+    LexAnalyser lexer(corpus);
+    lexer.get_profile().enabled = true;
+    lexer.tokenize();
+    result.profile = lexer.get_profile();
+    return result;
+}
+
+static void print_text(const bench_result_t &r)
+{
+    printf("%-9s %10zu bytes %9zu tokens %9.3f ms %12.0f tokens/s %8.2f MB/s\n",
+           CorpusGenerator::mix_name(r.mix), r.bytes, r.tokens, r.seconds * 1e3,
+           r.tokens / r.seconds, r.bytes / r.seconds / 1e6);
+    unsigned long long total = 0;
+    for (int h = 0; h < HANDLER_COUNT; h++)
+        total += r.profile.nanoseconds[h];
+    for (int h = 0; h < HANDLER_COUNT; h++)
+    {
+        printf("    %-30s %9llu calls %10llu bytes %9.3f ms %5.1f%%\n", lex_handler_names[h],
+               r.profile.calls[h], r.profile.bytes[h], r.profile.nanoseconds[h] / 1e6,
+               total ? 100.0 * r.profile.nanoseconds[h] / total : 0.0);
+    }
+}
+
+static void print_json(FILE *out, const vector<bench_result_t> &results, uint64_t seed)
+{
+    fprintf(out, "{\n  \"seed\": %llu,\n  \"results\": [\n", static_cast<unsigned long long>(seed));
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const bench_result_t &r = results[i];
+        unsigned long long total = 0;
+        for (int h = 0; h < HANDLER_COUNT; h++)
+            total += r.profile.nanoseconds[h];
+        fprintf(out, "    {\"mix\": \"%s\", \"bytes\": %zu, \"tokens\": %zu, \"seconds\": %.9f, "
+                     "\"tokens_per_sec\": %.1f, \"bytes_per_sec\": %.1f, \"handlers\": {",
+                CorpusGenerator::mix_name(r.mix), r.bytes, r.tokens, r.seconds,
+                r.tokens / r.seconds, r.bytes / r.seconds);
+        for (int h = 0; h < HANDLER_COUNT; h++)
+        {
+            fprintf(out, "%s\"%s\": {\"calls\": %llu, \"bytes\": %llu, \"seconds\": %.9f, \"share\": %.4f}",
+                    h ? ", " : "", lex_handler_names[h], r.profile.calls[h], r.profile.bytes[h],
+                    r.profile.nanoseconds[h] / 1e9, total ? double(r.profile.nanoseconds[h]) / total : 0.0);
+        }
+        fprintf(out, "}}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--size BYTES] [--mix balanced|numeric|comment|string|operator|data|all]\n"
+            "          [--repeat N] [--seed N] [--json FILE|-] [--dump FILE]\n",
+            argv0);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t size = 4 << 20;
+    int repeat = 3;
+    uint64_t seed = 1;
+    string mix_arg = "all";
+    const char *json_path = nullptr;
+    const char *dump_path = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--size") == 0 && has_value)
+            size = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--mix") == 0 && has_value)
+            mix_arg = argv[++i];
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value)
+            repeat = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--json") == 0 && has_value)
+            json_path = argv[++i];
+        else if (strcmp(argv[i], "--dump") == 0 && has_value)
+            dump_path = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    vector<CorpusMix> mixes;
+    for (int m = 0; m < MIX_COUNT; m++)
+    {
+        if (mix_arg == "all" || mix_arg == CorpusGenerator::mix_name(CorpusMix(m)))
+            mixes.push_back(CorpusMix(m));
+    }
+    if (mixes.empty())
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (dump_path)
+    {
+        // 只输出语料本身，便于用 lex_analysis 等其他程序复现
+        ofstream dump(dump_path, ios::binary);
+        dump << CorpusGenerator(mixes[0], seed).generate(size);
+        return 0;
+    }
+
+    vector<bench_result_t> results;
+    for (CorpusMix mix : mixes)
+    {
+        results.push_back(run_bench(mix, size, seed, repeat));
+        if (!json_path || strcmp(json_path, "-") != 0)
+            print_text(results.back());
+    }
+
+    if (json_path)
+    {
+        FILE *out = strcmp(json_path, "-") == 0 ? stdout : fopen(json_path, "w");
+        if (!out)
+        {
+            perror(json_path);
+            return 1;
+        }
+        print_json(out, results, seed);
+        if (out != stdout)
+            fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "LexAnalysis.h"
+#include <limits>
+
+// apply_edit 对不合法编辑的检查：Release 构建中也要抛出异常，且不改动源程序与已有结果
+static int failures = 0;
+
+static void expect(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+template <class Exception>
+static bool throws(LexAnalyser &lexer, const text_edit_t &edit)
+{
+    try
+    {
+        lexer.apply_edit(edit);
+    }
+    catch (const Exception &)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    const string source = "int a = 1;\n";
+    LexAnalyser lexer(source);
+    lexer.tokenize();
+    size_t count = lexer.tokens().size();
+
+    expect(throws<std::out_of_range>(lexer, {source.length() + 1, 0, "x"}), "offset past the end");
+    expect(throws<std::out_of_range>(lexer, {4, source.length(), ""}), "removed range past the end");
+    expect(throws<std::out_of_range>(lexer, {4, std::numeric_limits<size_t>::max(), ""}), "offset + removed overflows");
+    expect(lexer.source() == source && lexer.tokens().size() == count, "rejected edits leave the lexer unchanged");
+
+    lexer.apply_edit({4, 1, "bb"});
+    expect(lexer.source() == "int bb = 1;\n" && lexer.tokens().size() == count, "valid edit is applied");
+    expect(throws<std::out_of_range>(lexer, {lexer.source().length() + 1, 0, ""}), "range checked against the edited source");
+    lexer.apply_edit({lexer.source().length(), 0, "int c;\n"});
+    expect(lexer.tokens().size() == count + 3, "edit at the end is accepted");
+
+    LexAnalyser borrowed(&source);
+    borrowed.tokenize();
+    expect(throws<std::logic_error>(borrowed, {0, 0, "x"}), "lexer over a borrowed buffer");
+    return failures == 0 ? 0 : 1;
+}
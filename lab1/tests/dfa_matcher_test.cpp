@@ -0,0 +1,34 @@
+#include <cstdio>
+#include <random>
+#include <string>
+#include "DFA.h"
+#include "dfa_scanners.h"
+#include "keys_patterns.h"
+
+// 生成的两种 dfa_matcher（终态排在最后 / 保留状态编号并用标志数组）与查表 DFA 的结果应完全一致
+int main()
+{
+    DFA constant_dfa(CONSTANT_DFA);
+    std::mt19937 rng(1);
+    const char alphabet[] = "0123456789.eE+-xXbBabcdefABCDEFuUlLp_ ";
+    int failures = 0;
+    for (int t = 0; t < 200000 && failures < 10; t++)
+    {
+        std::string input(rng() % 24, ' ');
+        for (auto &ch : input)
+            ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        dfa_scan_result_t tail = constant_matcher.scan(input.data(), input.size());
+        dfa_scan_result_t flags = constant_matcher_layout.scan(input.data(), input.size());
+        bool all = constant_dfa.all_match(input);
+        bool ok = tail.length == flags.length && tail.walked == flags.walked &&
+                  flags.walked == constant_dfa.longest_match(input) && (tail.tag < 0) == (flags.tag < 0) &&
+                  constant_matcher.all_match(input.data(), input.size()) == all &&
+                  constant_matcher_layout.all_match(input.data(), input.size()) == all;
+        if (!ok)
+        {
+            fprintf(stderr, "FAIL: \"%s\"\n", input.c_str());
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
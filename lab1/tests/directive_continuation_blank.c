@@ -0,0 +1,3 @@
+#define X \
+
+int a;
@@ -0,0 +1 @@
+#define X \
\ No newline at end of file
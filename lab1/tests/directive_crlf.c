@@ -0,0 +1,5 @@
+#define X 1 \
+  + 2
+#define Y \
+
+int a;
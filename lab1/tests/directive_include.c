@@ -0,0 +1,3 @@
+#include <stdio.h>
+#include "lex.h"
+int a;
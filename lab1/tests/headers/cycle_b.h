@@ -0,0 +1,3 @@
+int b;
+#include "cycle_a.h"
+#include "cycle_a.h"
@@ -0,0 +1,7 @@
+#ifndef SPLIT_A
+#define SPLIT_A
+int x;
+#endif
+#ifndef SPLIT_B
+int y;
+#endif
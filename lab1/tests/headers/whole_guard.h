@@ -0,0 +1,7 @@
+#ifndef WHOLE
+#define WHOLE
+#ifdef X
+int x;
+#endif
+int w;
+#endif
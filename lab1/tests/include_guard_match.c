@@ -0,0 +1,4 @@
+#include "split_guard.h"
+#include "split_guard.h"
+#include "whole_guard.h"
+#include "whole_guard.h"
@@ -0,0 +1,15 @@
+# 以 INPUT 为标准输入运行 LEXER（附加参数 ARGS，空格分隔），输出须与 EXPECTED 逐字节相同
+separate_arguments(ARGS UNIX_COMMAND "${ARGS}")
+execute_process(
+    COMMAND ${LEXER} ${ARGS}
+    INPUT_FILE ${INPUT}
+    OUTPUT_VARIABLE output
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${LEXER} exited with ${result}")
+endif()
+file(READ ${EXPECTED} expected)
+if(NOT output STREQUAL expected)
+    message(FATAL_ERROR "output differs from ${EXPECTED}:\n${output}")
+endif()